@@ -0,0 +1,238 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \file   Leddar/LdAsyncSubscriber.cpp
+///
+/// \brief  Implements the LdAsyncSubscriber class
+///
+/// Copyright (c) 2018 LeddarTech. All rights reserved.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "LdAsyncSubscriber.h"
+
+#include "comm/Canbus/LtComCanbus.h"
+
+#include <cstring>
+#include <stdexcept>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn LeddarCore::LdAsyncSubscriber::LdAsyncSubscriber( LdObject *aReceiver, size_t aQueueSize, eBackpressure aPolicy )
+///
+/// \brief  Constructor. Starts the thread that calls the receiver callback.
+///
+/// \exception  std::invalid_argument   Thrown if the receiver is null or the queue size is 0.
+///
+/// \param [in] aReceiver   Object whose Callback is called from the subscriber thread.
+/// \param      aQueueSize  Maximum number of pending signals.
+/// \param      aPolicy     What to do with a new signal when the queue is full.
+///
+/// \author David Levy
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+LeddarCore::LdAsyncSubscriber::LdAsyncSubscriber( LdObject *aReceiver, size_t aQueueSize, eBackpressure aPolicy ) :
+    mReceiver( aReceiver ),
+    mQueueSize( aQueueSize ),
+    mPolicy( aPolicy ),
+    mStop( false ),
+    mCallers( 0 ),
+    mDroppedCount( 0 ),
+    mDispatchedCount( 0 ),
+    mFailedCount( 0 )
+{
+    if( aReceiver == nullptr || aQueueSize == 0 )
+    {
+        throw std::invalid_argument( "Invalid receiver or queue size." );
+    }
+
+    mThread = std::thread( &LdAsyncSubscriber::Run, this );
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn LeddarCore::LdAsyncSubscriber::~LdAsyncSubscriber()
+///
+/// \brief  Destructor. Stops first, which releases the emitters blocked in Callback, then disconnects from the senders.
+///         Pending signals are dropped. Must run on the emitting thread or while the senders do not emit (see the class).
+///
+/// \author David Levy
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+LeddarCore::LdAsyncSubscriber::~LdAsyncSubscriber()
+{
+    Stop();
+    DisconnectAll();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LeddarCore::LdAsyncSubscriber::Callback( LdObject *aSender, const SIGNALS aSignal, void *aExtraData )
+///
+/// \brief  Called by the sender (on the emitting thread). Queues the signal for the subscriber thread.
+///
+/// \param [in] aSender     The sender.
+/// \param      aSignal     The signal.
+/// \param [in] aExtraData  Extra data, forwarded as is.
+///
+/// \author David Levy
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void
+LeddarCore::LdAsyncSubscriber::Callback( LdObject *aSender, const SIGNALS aSignal, void *aExtraData )
+{
+    sSignal lSignal = { aSender, aSignal, aExtraData, false, { 0, 0 } };
+    CopyPayload( lSignal );
+
+    std::unique_lock<std::mutex> lLock( mMutex );
+
+    if( mPolicy == BP_BLOCK )
+    {
+        ++mCallers;
+        mNotFull.wait( lLock, [this] { return mStop || mQueue.size() < mQueueSize; } );
+
+        if( --mCallers == 0 && mStop )
+        {
+            mIdle.notify_all();
+        }
+    }
+
+    if( mStop )
+    {
+        return;
+    }
+
+    if( mQueue.size() >= mQueueSize )
+    {
+        ++mDroppedCount;
+
+        if( mPolicy == BP_DROP_NEWEST )
+        {
+            return;
+        }
+
+        mQueue.pop_front();
+    }
+
+    mQueue.push_back( lSignal );
+    lLock.unlock();
+    mNotEmpty.notify_one();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LeddarCore::LdAsyncSubscriber::CopyPayload( sSignal &aSignal )
+///
+/// \brief  Copy the extra data that lives on the stack of the emitter in mPayload, and set mCopied.
+///
+/// \param [in,out]    aSignal The signal.
+///
+/// \author David Levy
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void
+LeddarCore::LdAsyncSubscriber::CopyPayload( sSignal &aSignal )
+{
+    static_assert( sizeof( LtComCanBus::sCanData ) <= sizeof( aSignal.mPayload ), "Payload too small for a CAN frame" );
+
+    size_t lSize = 0;
+
+    if( aSignal.mExtraData != nullptr )
+    {
+        if( aSignal.mSignal == NEW_DATA )
+        {
+            lSize = sizeof( LtComCanBus::sCanData ); //Only LdInterfaceCan emits NEW_DATA with extra data
+        }
+        else if( aSignal.mSignal == DEVICE_ID_CHANGED )
+        {
+            lSize = sizeof( uint32_t );
+        }
+    }
+
+    if( lSize != 0 )
+    {
+        memcpy( aSignal.mPayload, aSignal.mExtraData, lSize );
+        aSignal.mCopied = true;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LeddarCore::LdAsyncSubscriber::Stop( void )
+///
+/// \brief  Stops the subscriber thread. The signal being dispatched is completed, the pending ones are dropped.
+///         The emitters blocked in Callback (BP_BLOCK) return without queuing, Stop waits for them.
+///         Must not be called from the receiver callback.
+///
+/// \author David Levy
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void
+LeddarCore::LdAsyncSubscriber::Stop( void )
+{
+    {
+        std::lock_guard<std::mutex> lLock( mMutex );
+        mStop = true;
+        mQueue.clear();
+    }
+
+    mNotEmpty.notify_all();
+    mNotFull.notify_all();
+
+    if( mThread.joinable() )
+    {
+        mThread.join();
+    }
+
+    std::unique_lock<std::mutex> lLock( mMutex );
+    mIdle.wait( lLock, [this] { return mCallers == 0; } );
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn size_t LeddarCore::LdAsyncSubscriber::GetQueuedCount( void )
+///
+/// \brief  Number of signals waiting to be dispatched.
+///
+/// \author David Levy
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+size_t
+LeddarCore::LdAsyncSubscriber::GetQueuedCount( void )
+{
+    std::lock_guard<std::mutex> lLock( mMutex );
+    return mQueue.size();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LeddarCore::LdAsyncSubscriber::Run( void )
+///
+/// \brief  Subscriber thread. Calls the receiver callback for every queued signal, in order.
+///
+/// \author David Levy
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void
+LeddarCore::LdAsyncSubscriber::Run( void )
+{
+    std::unique_lock<std::mutex> lLock( mMutex );
+
+    for( ;; )
+    {
+        mNotEmpty.wait( lLock, [this] { return mStop || !mQueue.empty(); } );
+
+        if( mStop )
+        {
+            return;
+        }
+
+        sSignal lSignal = mQueue.front();
+        mQueue.pop_front();
+        lLock.unlock();
+        mNotFull.notify_one();
+
+        try
+        {
+            mReceiver->Callback( lSignal.mSender, lSignal.mSignal, lSignal.mCopied ? lSignal.mPayload : lSignal.mExtraData );
+        }
+        catch( ... )
+        {
+            //Nobody to report the error to on this thread, do not let it terminate the application
+            ++mFailedCount;
+        }
+
+        ++mDispatchedCount;
+        lLock.lock();
+    }
+}
@@ -0,0 +1,92 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \file   Leddar/LdAsyncSubscriber.h
+///
+/// \brief  Declares the LdAsyncSubscriber class
+///
+/// Copyright (c) 2018 LeddarTech. All rights reserved.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "LdObject.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+namespace LeddarCore
+{
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \class  LdAsyncSubscriber
+    ///
+    /// \brief  Forwards the signals it receives to another object from its own thread.
+    ///
+    ///         Connect the LdAsyncSubscriber instead of the receiver ( aSender->ConnectSignal( &lAsync, NEW_DATA ) ).
+    ///         EmitSignal only pushes the signal in a bounded queue, the receiver Callback is called by the subscriber thread.
+    ///         A slow receiver no longer delays the thread that emits the signal (usually the one calling GetData).
+    ///         When the queue is full, the backpressure policy decides what happens.
+    ///
+    ///         The callback runs after the emission, so the receiver should read the latest data (or use LdResultEchoes::GetFrame).
+    ///         The extra data of the signals that point to the stack of the emitter is copied: the CAN frame of NEW_DATA
+    ///         (LdInterfaceCan, null for the sensors) and the old id of DEVICE_ID_CHANGED. The other pointers are forwarded
+    ///         as is (VALUE_CHANGED gives the property), they must stay valid until the callback is done.
+    ///
+    ///         LdObject does not lock its receiver lists: connect, disconnect and destroy the subscriber from the thread
+    ///         that emits the signals, or while the sender does not emit.
+    ///
+    /// \author David Levy
+    /// \date   October 2026
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    class LdAsyncSubscriber : public LdObject
+    {
+    public:
+        enum eBackpressure
+        {
+            BP_DROP_OLDEST, ///< Drop the oldest queued signal to make room for the new one
+            BP_DROP_NEWEST, ///< Drop the new signal
+            BP_BLOCK        ///< Wait in EmitSignal until there is room in the queue
+        };
+
+        LdAsyncSubscriber( LdObject *aReceiver, size_t aQueueSize = 4, eBackpressure aPolicy = BP_DROP_OLDEST );
+        ~LdAsyncSubscriber();
+
+        virtual void    Callback( LdObject *aSender, const SIGNALS aSignal, void *aExtraData ) override;
+        void            Stop( void );
+
+        uint64_t        GetDroppedCount( void ) const { return mDroppedCount; }
+        uint64_t        GetDispatchedCount( void ) const { return mDispatchedCount; }
+        uint64_t        GetFailedCount( void ) const { return mFailedCount; }
+        size_t          GetQueuedCount( void );
+
+    private:
+        struct sSignal
+        {
+            LdObject   *mSender;
+            SIGNALS     mSignal;
+            void       *mExtraData;
+            bool        mCopied;        ///< The receiver gets mPayload instead of mExtraData
+            uint64_t    mPayload[2];    ///< Copy of the extra data, see CopyPayload
+        };
+
+        static void CopyPayload( sSignal &aSignal );
+
+        void Run( void );
+
+        LdObject               *mReceiver;
+        size_t                  mQueueSize;
+        eBackpressure           mPolicy;
+        std::deque<sSignal>     mQueue;
+        std::mutex              mMutex;
+        std::condition_variable mNotEmpty;
+        std::condition_variable mNotFull;
+        std::condition_variable mIdle;
+        bool                    mStop;
+        unsigned int            mCallers;           ///< Emitters inside Callback, waited for by Stop
+        std::atomic<uint64_t>   mDroppedCount;
+        std::atomic<uint64_t>   mDispatchedCount;
+        std::atomic<uint64_t>   mFailedCount;       ///< Receiver callbacks that threw
+        std::thread             mThread;
+    };
+}
@@ -40,6 +40,8 @@ LeddarConnection::LdCanKomodo::LdCanKomodo( const LdConnectionInfoCan *aConnecti
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 LeddarConnection::LdCanKomodo::~LdCanKomodo()
 {
+    StopReceiveThread(); //Before the object is partly destroyed, the thread calls ReadFrame
+
     if( mMaster == nullptr && mHandle != 0 )
     {
         LdCanKomodo::Disconnect(); //We dont want virtual function in destructor
@@ -145,6 +147,8 @@ void LeddarConnection::LdCanKomodo::Disconnect( void )
         throw std::logic_error( "Only the \"master\" sensor can disconnect" );
     }
 
+    StopReceiveThread();
+
     if( mHandle != 0 )
     {
         km_disable( mHandle );
@@ -178,35 +182,57 @@ bool LeddarConnection::LdCanKomodo::Read( const LdInterfaceCan *aRequestingInter
     }
     else
     {
-        std::vector<uint8_t> lData( 8 );
-        km_can_info_t lInfo;
-        km_can_packet_t lPacket;
-
-        int lResult = km_can_read( mHandle, &lInfo, &lPacket, static_cast<int>( lData.size() ), &lData[0] );
+        const LdInterfaceCan *lReceiver = nullptr;
+        return ReadFrame( lReceiver ) && lReceiver == aRequestingInterface;
+    }
+}
 
-        if( lResult == KM_CAN_READ_EMPTY )
-        {
-            return false;
-        }
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn bool LeddarConnection::LdCanKomodo::ReadFrame( const LdInterfaceCan *&aReceiver )
+///
+/// \brief  Reads one frame from the adapter (non blocking) and forwards it to the interface with the corresponding id
+///
+/// \exception  std::runtime_error  Raised there is an error reading data.
+///
+/// \param [out]    aReceiver   The interface that received the frame, nullptr if it was ignored
+///
+/// \return True if a frame was read, else false.
+///
+/// \author David Levy
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool LeddarConnection::LdCanKomodo::ReadFrame( const LdInterfaceCan *&aReceiver )
+{
+    std::vector<uint8_t> lData( 8 );
+    km_can_info_t lInfo;
+    km_can_packet_t lPacket;
+    int lResult;
 
-        if( lResult < KM_OK )
-        {
-            throw std::runtime_error( "Couldnt read answer: " + std::string( km_status_string( lResult ) ) );
-        }
+    {
+        std::lock_guard<std::mutex> lLock( mHandleMutex );
+        lResult = km_can_read( mHandle, &lInfo, &lPacket, static_cast<int>( lData.size() ), &lData[0] );
+    }
 
-        if( lInfo.events != 0 )
-        {
-            throw std::runtime_error( lEventString );
-        }
+    if( lResult == KM_CAN_READ_EMPTY )
+    {
+        return false;
+    }
 
-        if( lPacket.id == 0 ) //Unexpected packet received (probably from vu8)
-            return false;
+    if( lResult < KM_OK )
+    {
+        throw std::runtime_error( "Couldnt read answer: " + std::string( km_status_string( lResult ) ) );
+    }
 
-        if( ForwardDataMaster( lPacket.id, lData ) == aRequestingInterface )
-            return true;
-        else
-            return false;
+    if( lInfo.events != 0 )
+    {
+        throw std::runtime_error( lEventString );
     }
+
+    if( lPacket.id == 0 ) //Unexpected packet received (probably from vu8)
+        return true;
+
+    aReceiver = ForwardDataMaster( lPacket.id, lData );
+    return true;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -239,6 +265,7 @@ void LeddarConnection::LdCanKomodo::Write( uint16_t aId, const std::vector<uint8
         lPacket.id = aId;
 
         uint32_t lArbCount[8] = {0};
+        std::lock_guard<std::mutex> lLock( mHandleMutex );
         int lResult = km_can_write( mHandle, static_cast<km_can_ch_t>( lInfo->GetChannel() ), 0, &lPacket, static_cast<int>( aData.size() ), &aData[0], lArbCount );
 
         if( lResult != KM_OK )
@@ -276,9 +303,9 @@ bool LeddarConnection::LdCanKomodo::WriteAndWaitForAnswer( uint16_t aId, const s
 
             while( true )
             {
-                if( !Read( this ) )
+                if( !Read() )
                 {
-                    LeddarUtils::LtTimeUtils::Wait( 1 );
+                    WaitForData( 1 );
 
                     if( ++lCount > 1000 )
                     {
@@ -375,9 +402,9 @@ void LeddarConnection::LdCanKomodo::WasteEvent( void )
 
             while( true )
             {
-                if( !Read( this ) )
+                if( !Read() )
                 {
-                    LeddarUtils::LtTimeUtils::Wait( 50 );
+                    WaitForData( 50 );
 
                     if( ++lCount > 10 )
                     {
@@ -31,13 +31,18 @@ namespace LeddarConnection
         virtual void    Disconnect( void ) override;
 
         virtual bool    Read( const LdInterfaceCan *aRequestingInterface ) override ;
+        using           LdInterfaceCan::Read;
         virtual void    Write( uint16_t aId, const std::vector<uint8_t> &aData ) override;
         virtual bool    WriteAndWaitForAnswer( uint16_t aId, const std::vector<uint8_t> &aData ) override; //Not recommended to use this function when the sensor is in "stream" mode
 
         static std::vector<LdConnectionInfo *> GetDeviceList( void );
 
+    protected:
+        virtual bool    ReadFrame( const LdInterfaceCan *&aReceiver ) override;
+
     private:
-        int  mHandle; // mHandle > 0 if it is valid
+        int         mHandle; // mHandle > 0 if it is valid
+        std::mutex  mHandleMutex; // The receive thread reads while the caller writes
 
         void WasteEvent( void );
     };
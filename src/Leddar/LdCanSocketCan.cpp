@@ -0,0 +1,548 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \file   Leddar/LdCanSocketCan.cpp
+///
+/// \brief  Implements the LdCanSocketCan class. An implementation of the CAN protocol using Linux SocketCAN.
+///             For multi-sensors setup, one connection is the "master" and behaves as a router
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "LdCanSocketCan.h"
+#if defined(BUILD_CANBUS_SOCKETCAN) && defined(BUILD_CANBUS)
+
+#include "LtStringUtils.h"
+#include "LtTimeUtils.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <ctime>
+
+#include <linux/can.h>
+#include <linux/can/raw.h>
+#include <net/if.h>
+#include <net/if_arp.h>
+#include <poll.h>
+#include <sys/ioctl.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+namespace
+{
+    const unsigned int SOCKETCAN_BATCH_SIZE = 32;       ///< Frames read by one recvmmsg
+    const int SOCKETCAN_POLL_TIMEOUT_MS = 10;           ///< Receive thread wait, short so it checks for Stop
+    const uint8_t SOCKETCAN_WRITE_RETRY = 10;           ///< Retries (1 ms apart) when the tx queue of the interface is full
+
+    std::string ErrnoString( int aErrno )
+    {
+        return std::string( strerror( aErrno ) );
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn LeddarConnection::LdCanSocketCan::LdCanSocketCan( const LdConnectionInfoCan *aConnectionInfo, LdConnection *aExistingConnection )
+///
+/// \brief  Constructor
+///
+/// \param          aConnectionInfo     Information describing the connection. The description is the interface name.
+/// \param [in,out] aExistingConnection If non-null, the existing connection (for multiple sensor on the same interface).
+///
+/// \author David Levy
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+LeddarConnection::LdCanSocketCan::LdCanSocketCan( const LdConnectionInfoCan *aConnectionInfo, LdConnection *aExistingConnection ) : LdInterfaceCan( aConnectionInfo, aExistingConnection ),
+    mSocket( -1 ),
+    mBatchIndex( 0 )
+{
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn LeddarConnection::LdCanSocketCan::~LdCanSocketCan()
+///
+/// \brief  Destructor
+///
+/// \author David Levy
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+LeddarConnection::LdCanSocketCan::~LdCanSocketCan()
+{
+    StopReceiveThread(); //Before the object is partly destroyed, the thread calls ReadFrame
+
+    if( mMaster == nullptr && mSocket >= 0 )
+    {
+        LdCanSocketCan::Disconnect(); //We dont want virtual function in destructor
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LeddarConnection::LdCanSocketCan::Connect( void )
+///
+/// \brief  Opens a raw CAN socket on the interface, enables the kernel reception timestamps and
+///         sets the reception filters.
+///
+/// \exception  std::logic_error    Raised when a called from a sensor that does not own the
+///                                 connection.
+/// \exception  std::runtime_error  Raised when already connected or when the interface cant be opened.
+///
+/// \author David Levy
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void LeddarConnection::LdCanSocketCan::Connect( void )
+{
+    if( mMaster != nullptr )
+    {
+        throw std::logic_error( "Only the \"master\" sensor can connect" );
+    }
+
+    if( mSocket >= 0 )
+    {
+        throw std::runtime_error( "Already connected" );
+    }
+
+    const LdConnectionInfoCan *lInfo = dynamic_cast< const LdConnectionInfoCan *>( GetConnectionInfo() );
+    unsigned int lIndex = if_nametoindex( lInfo->GetDescription().c_str() );
+
+    if( lIndex == 0 )
+    {
+        throw std::runtime_error( "Unable to connect: no CAN interface named " + lInfo->GetDescription() );
+    }
+
+    mSocket = socket( PF_CAN, SOCK_RAW | SOCK_CLOEXEC, CAN_RAW );
+
+    if( mSocket < 0 )
+    {
+        throw std::runtime_error( "Unable to connect: " + ErrnoString( errno ) );
+    }
+
+    int lEnable = 1;
+
+    if( setsockopt( mSocket, SOL_SOCKET, SO_TIMESTAMPNS, &lEnable, sizeof( lEnable ) ) != 0 )
+    {
+        int lErrno = errno;
+        Disconnect();
+        throw std::runtime_error( "Cant enable reception timestamps: " + ErrnoString( lErrno ) );
+    }
+
+    try
+    {
+        ApplyFilters(); //Before bind, the default filter receives everything
+    }
+    catch( ... )
+    {
+        Disconnect();
+        throw;
+    }
+
+    struct sockaddr_can lAddress = {};
+    lAddress.can_family = AF_CAN;
+    lAddress.can_ifindex = static_cast<int>( lIndex );
+
+    if( bind( mSocket, reinterpret_cast<struct sockaddr *>( &lAddress ), sizeof( lAddress ) ) != 0 )
+    {
+        int lErrno = errno;
+        Disconnect();
+        throw std::runtime_error( "Unable to bind to " + lInfo->GetDescription() + ": " + ErrnoString( lErrno ) );
+    }
+
+    mIsConnected = true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LeddarConnection::LdCanSocketCan::Disconnect( void )
+///
+/// \brief  Closes the socket. Should only be called from the sensor that owns the connection
+///
+/// \exception  std::logic_error    Raised when a called from a sensor that does not own the connection.
+///
+/// \author David Levy
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void LeddarConnection::LdCanSocketCan::Disconnect( void )
+{
+    if( mMaster != nullptr )
+    {
+        throw std::logic_error( "Only the \"master\" sensor can disconnect" );
+    }
+
+    StopReceiveThread();
+
+    if( mSocket >= 0 )
+    {
+        close( mSocket );
+        mSocket = -1;
+        mIsConnected = false;
+    }
+
+    std::lock_guard<std::mutex> lLock( mBatchMutex );
+    mBatch.clear();
+    mBatchIndex = 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LeddarConnection::LdCanSocketCan::ApplyFilters( void )
+///
+/// \brief  Sets the kernel reception filters (CAN_RAW_FILTER) to the ids of the registered interfaces.
+///         Each id range is split in aligned power of 2 blocks, one id / mask filter per block.
+///         Frames of the other devices on the bus are dropped before they reach the socket.
+///
+/// \exception  std::runtime_error  Raised when the filters cant be set.
+///
+/// \author David Levy
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void LeddarConnection::LdCanSocketCan::ApplyFilters( void )
+{
+    const LdConnectionInfoCan *lInfo = dynamic_cast< const LdConnectionInfoCan *>( GetConnectionInfo() );
+    const bool lExtended = !lInfo->GetStandardFrameFormat();
+    const canid_t lIdMask = lExtended ? CAN_EFF_MASK : CAN_SFF_MASK;
+
+    std::vector<std::pair<uint16_t, uint16_t> > lRanges = GetRegisteredIdRanges();
+    std::vector<struct can_filter> lFilters;
+
+    for( size_t i = 0; i < lRanges.size(); ++i )
+    {
+        uint32_t lFirst = lRanges[i].first;
+        const uint32_t lLast = lRanges[i].second;
+
+        while( lFirst <= lLast )
+        {
+            uint32_t lSize = 1;
+
+            while( ( lFirst & ( lSize * 2 - 1 ) ) == 0 && lFirst + lSize * 2 - 1 <= lLast )
+            {
+                lSize *= 2;
+            }
+
+            struct can_filter lFilter;
+            lFilter.can_id = lFirst | ( lExtended ? CAN_EFF_FLAG : 0 );
+            lFilter.can_mask = ( ~( lSize - 1 ) & lIdMask ) | CAN_EFF_FLAG | CAN_RTR_FLAG;
+            lFilters.push_back( lFilter );
+            lFirst += lSize;
+        }
+    }
+
+    // No filter means no frame received, until an interface is registered
+    if( setsockopt( mSocket, SOL_CAN_RAW, CAN_RAW_FILTER, lFilters.empty() ? nullptr : &lFilters[0],
+                    static_cast<socklen_t>( lFilters.size() * sizeof( struct can_filter ) ) ) != 0 )
+    {
+        throw std::runtime_error( "Cant set CAN filters: " + ErrnoString( errno ) );
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LeddarConnection::LdCanSocketCan::RegisteredIdsChanged( void )
+///
+/// \brief  Update the kernel filters when a sensor is added or removed on the interface.
+///
+/// \author David Levy
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void LeddarConnection::LdCanSocketCan::RegisteredIdsChanged( void )
+{
+    if( mSocket >= 0 )
+    {
+        ApplyFilters();
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn bool LeddarConnection::LdCanSocketCan::Read( const LdInterfaceCan *aRequestingInterface )
+///
+/// \brief  Reads data from the CANbus
+///
+/// \exception  std::runtime_error  Raised there is an error reading data.
+///
+/// \param  aRequestingInterface    The interface that requested the read
+///
+/// \return True if data is received, else false.
+///
+/// \author David Levy
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool LeddarConnection::LdCanSocketCan::Read( const LdInterfaceCan *aRequestingInterface )
+{
+    if( mMaster != nullptr )
+    {
+        return mMaster->Read( aRequestingInterface );
+    }
+    else
+    {
+        const LdInterfaceCan *lReceiver = nullptr;
+        return ReadFrame( lReceiver ) && lReceiver == aRequestingInterface;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn size_t LeddarConnection::LdCanSocketCan::ReceiveBatch( void )
+///
+/// \brief  Reads all the frames waiting in the socket (up to SOCKETCAN_BATCH_SIZE) with one recvmmsg, without blocking.
+///         The kernel timestamps (wall clock) are converted to the host monotonic clock.
+///
+/// \exception  std::runtime_error  Raised there is an error reading data.
+///
+/// \return The number of frames read.
+///
+/// \author David Levy
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+size_t LeddarConnection::LdCanSocketCan::ReceiveBatch( void )
+{
+    struct can_frame lFrames[SOCKETCAN_BATCH_SIZE];
+    struct iovec lIov[SOCKETCAN_BATCH_SIZE];
+    struct mmsghdr lMessages[SOCKETCAN_BATCH_SIZE];
+    char lControl[SOCKETCAN_BATCH_SIZE][CMSG_SPACE( sizeof( struct timespec ) )];
+
+    memset( lMessages, 0, sizeof( lMessages ) );
+
+    for( unsigned int i = 0; i < SOCKETCAN_BATCH_SIZE; ++i )
+    {
+        lIov[i].iov_base = &lFrames[i];
+        lIov[i].iov_len = sizeof( struct can_frame );
+        lMessages[i].msg_hdr.msg_iov = &lIov[i];
+        lMessages[i].msg_hdr.msg_iovlen = 1;
+        lMessages[i].msg_hdr.msg_control = lControl[i];
+        lMessages[i].msg_hdr.msg_controllen = sizeof( lControl[i] );
+    }
+
+    int lCount = recvmmsg( mSocket, lMessages, SOCKETCAN_BATCH_SIZE, MSG_DONTWAIT, nullptr );
+
+    if( lCount < 0 )
+    {
+        if( errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR )
+        {
+            return 0;
+        }
+
+        throw std::runtime_error( "Couldnt read answer: " + ErrnoString( errno ) );
+    }
+
+    // Offset between the wall clock of the kernel timestamps and the monotonic clock
+    struct timespec lRealTime;
+    clock_gettime( CLOCK_REALTIME, &lRealTime );
+    const uint64_t lNow = LeddarUtils::LtTimeUtils::GetMonotonicNanoseconds();
+    const int64_t lOffset = static_cast<int64_t>( lRealTime.tv_sec ) * 1000000000LL + lRealTime.tv_nsec - static_cast<int64_t>( lNow );
+
+    mBatch.clear();
+    mBatchIndex = 0;
+
+    for( int i = 0; i < lCount; ++i )
+    {
+        if( lMessages[i].msg_len < sizeof( struct can_frame ) )
+        {
+            continue;
+        }
+
+        sFrame lFrame;
+        lFrame.mId = lFrames[i].can_id;
+        lFrame.mDlc = std::min<uint8_t>( lFrames[i].can_dlc, 8 );
+        memcpy( lFrame.mData, lFrames[i].data, sizeof( lFrame.mData ) );
+        lFrame.mTimestamp = lNow;
+
+        for( struct cmsghdr *lCmsg = CMSG_FIRSTHDR( &lMessages[i].msg_hdr ); lCmsg != nullptr; lCmsg = CMSG_NXTHDR( &lMessages[i].msg_hdr, lCmsg ) )
+        {
+            if( lCmsg->cmsg_level == SOL_SOCKET && lCmsg->cmsg_type == SCM_TIMESTAMPNS )
+            {
+                struct timespec lStamp;
+                memcpy( &lStamp, CMSG_DATA( lCmsg ), sizeof( lStamp ) );
+                int64_t lMonotonic = static_cast<int64_t>( lStamp.tv_sec ) * 1000000000LL + lStamp.tv_nsec - lOffset;
+
+                if( lMonotonic > 0 && static_cast<uint64_t>( lMonotonic ) <= lNow )
+                {
+                    lFrame.mTimestamp = static_cast<uint64_t>( lMonotonic );
+                }
+            }
+        }
+
+        mBatch.push_back( lFrame );
+    }
+
+    return mBatch.size();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn bool LeddarConnection::LdCanSocketCan::ReadFrame( const LdInterfaceCan *&aReceiver )
+///
+/// \brief  Forwards the next frame of the current batch, reads a new batch from the socket when it is empty
+///
+/// \exception  std::runtime_error  Raised there is an error reading data.
+///
+/// \param [out]    aReceiver   The interface that received the frame, nullptr if it was ignored
+///
+/// \return True if a frame was read, else false.
+///
+/// \author David Levy
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool LeddarConnection::LdCanSocketCan::ReadFrame( const LdInterfaceCan *&aReceiver )
+{
+    sFrame lFrame;
+
+    {
+        std::lock_guard<std::mutex> lLock( mBatchMutex );
+
+        if( mBatchIndex >= mBatch.size() && ReceiveBatch() == 0 )
+        {
+            return false;
+        }
+
+        lFrame = mBatch[mBatchIndex++];
+    }
+
+    const LdConnectionInfoCan *lInfo = dynamic_cast< const LdConnectionInfoCan *>( GetConnectionInfo() );
+    const uint32_t lId = lFrame.mId & ( lInfo->GetStandardFrameFormat() ? CAN_SFF_MASK : CAN_EFF_MASK );
+
+    if( ( lFrame.mId & ( CAN_RTR_FLAG | CAN_ERR_FLAG ) ) != 0 || lId == 0 || lId > 0xFFFF ) //Unexpected packet received (probably from vu8)
+        return true;
+
+    std::vector<uint8_t> lData( 8 );
+    std::copy( lFrame.mData, lFrame.mData + lFrame.mDlc, lData.begin() );
+    aReceiver = ForwardDataMaster( static_cast<uint16_t>( lId ), lData, lFrame.mTimestamp );
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LeddarConnection::LdCanSocketCan::WaitForFrame( void )
+///
+/// \brief  Blocks the receive thread until the socket has a frame (or a short timeout)
+///
+/// \author David Levy
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void LeddarConnection::LdCanSocketCan::WaitForFrame( void )
+{
+    if( mSocket < 0 )
+    {
+        LdInterfaceCan::WaitForFrame();
+        return;
+    }
+
+    struct pollfd lPoll = {};
+    lPoll.fd = mSocket;
+    lPoll.events = POLLIN;
+    poll( &lPoll, 1, SOCKETCAN_POLL_TIMEOUT_MS );
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LeddarConnection::LdCanSocketCan::Write( uint16_t aId, const std::vector<uint8_t> &aData )
+///
+/// \brief  Writes provided data to the CANbus
+///
+/// \exception  std::invalid_argument   Raised when there is more than 8 bytes of data.
+/// \exception  std::runtime_error      Raised when there is an error writing data.
+///
+/// \param  aId     The identifier.
+/// \param  aData   The data.
+///
+/// \author David Levy
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void LeddarConnection::LdCanSocketCan::Write( uint16_t aId, const std::vector<uint8_t> &aData )
+{
+    if( mMaster != nullptr )
+    {
+        mMaster->Write( aId, aData );
+    }
+    else
+    {
+        if( aData.size() > CAN_MAX_DLEN )
+        {
+            throw std::invalid_argument( "Too much data for a CAN frame: " + LeddarUtils::LtStringUtils::IntToString( aData.size() ) );
+        }
+
+        const LdConnectionInfoCan *lInfo = dynamic_cast< const LdConnectionInfoCan *>( GetConnectionInfo() );
+
+        struct can_frame lFrame = {};
+        lFrame.can_id = aId | ( lInfo->GetStandardFrameFormat() ? 0 : CAN_EFF_FLAG );
+        lFrame.can_dlc = static_cast<uint8_t>( aData.size() );
+        std::copy( aData.begin(), aData.end(), lFrame.data );
+
+        uint8_t lRetry = SOCKETCAN_WRITE_RETRY;
+
+        while( write( mSocket, &lFrame, sizeof( lFrame ) ) != sizeof( lFrame ) )
+        {
+            if( errno != ENOBUFS || lRetry-- == 0 ) //ENOBUFS: tx queue of the interface is full
+            {
+                throw std::runtime_error( "Cant write to sensor: " + ErrnoString( errno ) );
+            }
+
+            LeddarUtils::LtTimeUtils::Wait( 1 );
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn bool LeddarConnection::LdCanSocketCan::WriteAndWaitForAnswer( uint16_t aId, const std::vector<uint8_t> &aData )
+///
+/// \brief  Writes an and wait for an answer.
+///
+/// \param  aId     The identifier.
+/// \param  aData   The data.
+///
+/// \return True if it succeeds, false if it fails.
+///
+/// \author David Levy
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool LeddarConnection::LdCanSocketCan::WriteAndWaitForAnswer( uint16_t aId, const std::vector<uint8_t> &aData )
+{
+    Write( aId, aData );
+
+    uint16_t lCount = 0;
+
+    while( !Read() )
+    {
+        WaitForData( 1 );
+
+        if( ++lCount > 1000 )
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn std::vector<LeddarConnection::LdConnectionInfo *> LeddarConnection::LdCanSocketCan::GetDeviceList( void )
+///
+/// \brief  Gets the list of the CAN network interfaces (can0, vcan0...)
+///
+/// \return Vector of connection info for each interface
+///             The description is the interface name, the port number is the interface index. Other info are default values
+///         Release ownership of all the pointers
+///
+/// \author David Levy
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+std::vector<LeddarConnection::LdConnectionInfo *> LeddarConnection::LdCanSocketCan::GetDeviceList( void )
+{
+    std::vector<LdConnectionInfo *> lConnecInfo;
+    struct if_nameindex *lInterfaces = if_nameindex();
+
+    if( lInterfaces == nullptr )
+    {
+        throw std::runtime_error( "Couldnt list network interfaces: " + ErrnoString( errno ) );
+    }
+
+    int lSocket = socket( AF_INET, SOCK_DGRAM | SOCK_CLOEXEC, 0 );
+
+    if( lSocket >= 0 )
+    {
+        for( struct if_nameindex *lInterface = lInterfaces; lInterface->if_index != 0; ++lInterface )
+        {
+            struct ifreq lRequest = {};
+            strncpy( lRequest.ifr_name, lInterface->if_name, IFNAMSIZ - 1 );
+
+            if( ioctl( lSocket, SIOCGIFHWADDR, &lRequest ) == 0 && lRequest.ifr_hwaddr.sa_family == ARPHRD_CAN )
+            {
+                lConnecInfo.push_back( new LeddarConnection::LdConnectionInfoCan( LeddarConnection::LdConnectionInfo::CT_CAN_SOCKETCAN, lInterface->if_name,
+                                       static_cast<uint16_t>( lInterface->if_index ) ) );
+            }
+        }
+
+        close( lSocket );
+    }
+
+    if_freenameindex( lInterfaces );
+    return lConnecInfo;
+}
+
+#endif
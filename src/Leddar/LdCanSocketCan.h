@@ -0,0 +1,68 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \file   Leddar/LdCanSocketCan.h
+///
+/// \brief  Declares the LdCanSocketCan class
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "LtDefines.h"
+#if defined(BUILD_CANBUS_SOCKETCAN) && defined(BUILD_CANBUS)
+
+#include "LdInterfaceCan.h"
+
+namespace LeddarConnection
+{
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \class  LdCanSocketCan
+    ///
+    /// \brief  An implementation of the CAN protocol using a Linux SocketCAN network interface (can0, vcan0...).
+    ///         The description of the connection info is the interface name.
+    ///         The bitrate is the one of the interface (ip link set can0 type can bitrate 1000000), the speed of the connection info is ignored.
+    ///         Frames are received in batches (recvmmsg), filtered by the kernel on the ids of the registered interfaces
+    ///         and timestamped by the kernel on reception (see LdInterfaceCan::GetReceiveTimestamp).
+    ///
+    /// \author David Levy
+    /// \date   October 2026
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    class LdCanSocketCan : public LdInterfaceCan
+    {
+    public:
+        explicit LdCanSocketCan( const LdConnectionInfoCan *aConnectionInfo, LdConnection *aExistingConnection = nullptr );
+        virtual ~LdCanSocketCan();
+
+        virtual void    Connect( void ) override;
+        virtual void    Disconnect( void ) override;
+
+        virtual bool    Read( const LdInterfaceCan *aRequestingInterface ) override ;
+        using           LdInterfaceCan::Read;
+        virtual void    Write( uint16_t aId, const std::vector<uint8_t> &aData ) override;
+        virtual bool    WriteAndWaitForAnswer( uint16_t aId, const std::vector<uint8_t> &aData ) override; //Not recommended to use this function when the sensor is in "stream" mode
+
+        static std::vector<LdConnectionInfo *> GetDeviceList( void );
+
+    protected:
+        virtual bool    ReadFrame( const LdInterfaceCan *&aReceiver ) override;
+        virtual void    RegisteredIdsChanged( void ) override;
+        virtual void    WaitForFrame( void ) override;
+
+    private:
+        struct sFrame
+        {
+            uint32_t    mId;        ///< Id with the SocketCAN flags
+            uint8_t     mDlc;
+            uint8_t     mData[8];
+            uint64_t    mTimestamp; ///< Host monotonic time of the reception, in ns
+        };
+
+        int                 mSocket;        // mSocket >= 0 if it is valid
+        std::vector<sFrame> mBatch;         // Frames of the last recvmmsg
+        size_t              mBatchIndex;    // Next frame of mBatch to forward
+        std::mutex          mBatchMutex;    // Read can be called while the receive thread reads
+
+        void    ApplyFilters( void );
+        size_t  ReceiveBatch( void );
+    };
+}
+
+#endif
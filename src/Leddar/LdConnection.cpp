@@ -33,6 +33,10 @@ LeddarConnection::LdConnection::LdConnection( const LdConnectionInfo *aConnectio
     mTransferInputBuffer( nullptr ),
     mTransferOutputBuffer( nullptr ),
     mTransferBufferSize( 0 ),
+#ifdef BUILD_TIMING_STATS
+    mTimingStats( nullptr ),
+#endif
+    mCounters( &mOwnCounters ),
     mOwner( false )
 {
 }
@@ -16,6 +16,8 @@
 
 #include "LdConnectionInfo.h"
 #include "LdObject.h"
+#include "LdTimingStats.h"
+#include "LdTransportCounters.h"
 
 #include <stdint.h>
 
@@ -34,10 +36,19 @@ namespace LeddarConnection
         virtual void                 SetDeviceType( uint16_t aDeviceType ) { mDeviceType = aDeviceType; }
         const LdConnectionInfo      *GetConnectionInfo( void ) const { return dynamic_cast< const LdConnectionInfo * >( mConnectionInfo ); }
         LdConnection                *GetInterface( void ) const { return mInterface; }
+        virtual const void          *GetTransportKey( void ) const { return mInterface != nullptr ? mInterface->GetTransportKey() : this; } //Connections with the same key share a transport that is not thread safe
         void                         TakeOwnerShip( bool aOwner ) { mOwner = aOwner; } //Take ownership of mConnectionInfo and mInterface
 
         virtual void                 ResizeInternalBuffers( const uint32_t &aSize );
         uint16_t                     GetInternalBuffersSize( void ) const { return mTransferBufferSize; }
+#ifdef BUILD_TIMING_STATS
+        void                         SetTimingStats( LdTimingStats *aStats ) { mTimingStats = aStats; }
+#endif
+
+        sTransportStats              GetTransportStats( void ) const { return mCounters->GetStats(); }
+        void                         ResetTransportStats( void ) { mCounters->Reset(); }
+        LdTransportCounters         &GetTransportCounters( void ) { return *mCounters; }
+        void                         ShareTransportCounters( LdConnection *aConnection ) { mCounters = aConnection->mCounters; } //Count in the counters of aConnection
 
     protected:
         explicit LdConnection( const LdConnectionInfo *aConnectionInfo, LdConnection *aInterface = nullptr );
@@ -48,8 +59,13 @@ namespace LeddarConnection
         uint8_t                 *mTransferInputBuffer; ///Sensor input: buffer of data we send to the sensor
         uint8_t                 *mTransferOutputBuffer; ///Sensor output: buffer of data we receive from the sensor
         uint32_t                 mTransferBufferSize;
+#ifdef BUILD_TIMING_STATS
+        LdTimingStats           *mTimingStats; ///Timing stats of the sensor using this connection, can be null
+#endif
+        LdTransportCounters     *mCounters; ///Transport counters, mOwnCounters unless shared with another connection
 
     private:
         bool mOwner;
+        LdTransportCounters mOwnCounters;
     };
 }
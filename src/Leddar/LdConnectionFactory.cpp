@@ -20,11 +20,13 @@
 #include "LdConnectionUniversalSpi.h"
 #include "LdConnectionUniversalModbus.h"
 #include "LdLibModbusSerial.h"
+#include "LdLibModbusTcp.h"
 #include "LdSpiFTDI.h"
 #include "LdProtocolLeddartechUSB.h"
 #include "LdLibUsb.h"
 #include "LdSpiBCM2835.h"
 #include "LdCanKomodo.h"
+#include "LdCanSocketCan.h"
 #include "LdProtocolCan.h"
 
 using namespace LeddarConnection;
@@ -97,11 +99,23 @@ LdConnectionFactory::CreateConnection( const LdConnectionInfo *aConnectionInfo,
 #endif
 #ifdef BUILD_MODBUS
 
-    if( aConnectionInfo->GetType() == LdConnectionInfo::CT_LIB_MODBUS )
+    if( aConnectionInfo->GetType() == LdConnectionInfo::CT_LIB_MODBUS || aConnectionInfo->GetType() == LdConnectionInfo::CT_LIB_MODBUS_TCP )
     {
         const LdConnectionInfoModbus *lConnectionInfo = dynamic_cast<const LdConnectionInfoModbus *>( aConnectionInfo );
-        LdInterfaceModbus *lConnectionModbus = new LdLibModbusSerial( lConnectionInfo, ( aConnection != nullptr &&
-                aConnection->GetInterface() != nullptr ? aConnection->GetInterface() : nullptr ) );
+        LdInterfaceModbus *lConnectionModbus = nullptr;
+
+        if( aConnectionInfo->GetType() == LdConnectionInfo::CT_LIB_MODBUS_TCP )
+        {
+            // The socket of the existing connection is shared, its requests are matched by transaction id
+            lConnectionModbus = new LdLibModbusTcp( dynamic_cast<const LdConnectionInfoModbusTcp *>( aConnectionInfo ), ( aConnection != nullptr &&
+                                                    aConnection->GetInterface() != nullptr ? aConnection->GetInterface() : aConnection ) );
+        }
+        else
+        {
+            lConnectionModbus = new LdLibModbusSerial( lConnectionInfo, ( aConnection != nullptr &&
+                    aConnection->GetInterface() != nullptr ? aConnection->GetInterface() : nullptr ) );
+        }
+
         lConnectionModbus->Connect();
 
         if( lConnectionModbus->GetDeviceType() != LtComLeddarTechPublic::LT_COMM_DEVICE_TYPE_VU8 && aForcedDeviceType == 0 )
@@ -125,13 +139,29 @@ LdConnectionFactory::CreateConnection( const LdConnectionInfo *aConnectionInfo,
 
 #endif
 
-#if defined(BUILD_CANBUS) && defined(BUILD_CANBUS_KOMODO)
+#if defined(BUILD_CANBUS)
+    LdInterfaceCan *lInterface = nullptr;
+    const LdConnectionInfoCan *lConnectionInfo = dynamic_cast<const LdConnectionInfoCan *>( aConnectionInfo );
+
+#if defined(BUILD_CANBUS_KOMODO)
 
     if( aConnectionInfo->GetType() == LdConnectionInfo::CT_CAN_KOMODO )
     {
-        const LdConnectionInfoCan *lConnectionInfo = dynamic_cast<const LdConnectionInfoCan *>( aConnectionInfo );
-        LdCanKomodo *lInterface = new LdCanKomodo( lConnectionInfo, aConnection );
+        lInterface = new LdCanKomodo( lConnectionInfo, aConnection );
+    }
+
+#endif
+#if defined(BUILD_CANBUS_SOCKETCAN)
+
+    if( aConnectionInfo->GetType() == LdConnectionInfo::CT_CAN_SOCKETCAN )
+    {
+        lInterface = new LdCanSocketCan( lConnectionInfo, aConnection );
+    }
+
+#endif
 
+    if( lInterface != nullptr )
+    {
         switch( aForcedDeviceType )
         {
             case LtComLeddarTechPublic::LT_COMM_DEVICE_TYPE_M16:
@@ -33,6 +33,7 @@ namespace LeddarConnection
 #endif
 #ifdef BUILD_MODBUS
             CT_LIB_MODBUS = 2,
+            CT_LIB_MODBUS_TCP = 8,
 #endif
 #ifdef BUILD_ETHERNET
             CT_ETHERNET_UNIVERSAL = 3,
@@ -42,7 +43,10 @@ namespace LeddarConnection
             CT_USB = 5,
 #endif
 #ifdef BUILD_CANBUS_KOMODO
-            CT_CAN_KOMODO = 6
+            CT_CAN_KOMODO = 6,
+#endif
+#ifdef BUILD_CANBUS_SOCKETCAN
+            CT_CAN_SOCKETCAN = 7
 #endif
         };
 
@@ -103,6 +103,32 @@ namespace LeddarConnection
         }
 
     protected:
+        // *****************************************************************************
+        // Function: LdConnectionInfoModbus::LdConnectionInfoModbus
+        //
+        /// \brief   Constructor for the Modbus transports without serial port settings.
+        ///
+        /// \param  aConnectionType Type of the connection.
+        /// \param  aAddress        Address of the device (host name, IP...).
+        /// \param  aDescription    Description of the connection.
+        /// \param  aModbusAddr     Modbus address (unit id) of the device.
+        ///
+        /// \author  David Levy
+        ///
+        /// \since   October 2026
+        // *****************************************************************************
+        LdConnectionInfoModbus( eConnectionType aConnectionType, const std::string &aAddress, const std::string &aDescription, uint8_t aModbusAddr ) :
+            LdConnectionInfo( aConnectionType, aAddress ),
+            mDescription( aDescription ),
+            mBaud( 0 ),
+            mParity( MB_PARITY_NONE ),
+            mDataBits( 8 ),
+            mStopBits( 1 ),
+            mModbusAddr( aModbusAddr )
+        {
+            SetAddress( aAddress );
+        }
+
         std::string mSerialPort;
         std::string mDescription;
         uint32_t    mBaud;
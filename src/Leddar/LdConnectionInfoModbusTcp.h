@@ -0,0 +1,65 @@
+// *****************************************************************************
+// Module..: Leddar
+//
+/// \file    LdConnectionInfoModbusTcp.h
+///
+/// \brief   Connection information on Modbus TCP devices (directly or through a
+///          Modbus TCP to RTU gateway).
+///
+/// \author  David Levy
+///
+/// \since   October 2026
+//
+// Copyright (c) 2026 LeddarTech Inc. All rights reserved.
+// *****************************************************************************
+
+#pragma once
+
+#include "LtDefines.h"
+#ifdef BUILD_MODBUS
+
+#include "LdConnectionInfoModbus.h"
+
+namespace LeddarConnection
+{
+    class LdConnectionInfoModbusTcp : public LdConnectionInfoModbus
+    {
+    public:
+        // *****************************************************************************
+        // Function: LdConnectionInfoModbusTcp::LdConnectionInfoModbusTcp
+        //
+        /// \brief   Constructor.
+        ///
+        /// \param  aHost           Host name or IP address of the device or of the gateway.
+        /// \param  aPort           TCP port (502 for Modbus TCP).
+        /// \param  aDescription    Description of the connection.
+        /// \param  aModbusAddr     Modbus address (unit id) of the device behind the gateway.
+        /// \param  aTimeout        Connection and answer timeout in ms (same default as the serial answer timeout).
+        ///
+        /// \author  David Levy
+        ///
+        /// \since   October 2026
+        // *****************************************************************************
+        LdConnectionInfoModbusTcp( const std::string &aHost, uint16_t aPort, const std::string &aDescription, uint8_t aModbusAddr, uint32_t aTimeout = 10000 ) :
+            LdConnectionInfoModbus( CT_LIB_MODBUS_TCP, aHost, aDescription, aModbusAddr ),
+            mHost( aHost ),
+            mPort( aPort ),
+            mTimeout( aTimeout )
+        {
+        }
+
+        virtual ~LdConnectionInfoModbusTcp() {}
+
+        std::string GetHost( void ) const { return mHost; }
+        uint16_t    GetPort( void ) const { return mPort; }
+        uint32_t    GetTimeout( void ) const { return mTimeout; }
+        void        SetTimeout( uint32_t aTimeout ) { mTimeout = aTimeout; }
+
+    protected:
+        std::string mHost;
+        uint16_t    mPort;
+        uint32_t    mTimeout;
+    };
+}
+
+#endif
@@ -16,7 +16,7 @@
 #include "LtTimeUtils.h"
 #include "comm/LtComLeddarTechPublic.h"
 
-
+#include <algorithm>
 #include <cstddef>
 #include <cstring>
 #include <iomanip>
@@ -24,6 +24,12 @@
 
 using namespace LeddarConnection;
 
+namespace
+{
+    const uint32_t READY_POLL_SPIN_COUNT = 2;       ///< Polls done right away before sleeping
+    const uint32_t READY_POLL_MIN_DELAY_US = 50;    ///< First sleep of the back off
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// \fn LdConnectionUniversal::LdConnectionUniversal( const LdConnectionInfo *aConnectionInfo, LdConnection *aInterface )
 ///
@@ -42,6 +48,7 @@ LdConnectionUniversal::LdConnectionUniversal( const LdConnectionInfo *aConnectio
     mDeviceReadyTimeout( 10 )
 {
     mIsBigEndian = LeddarUtils::LtIntUtilities::IsBigEndian();
+    memset( mReadyLatencyUs, 0, sizeof( mReadyLatencyUs ) );
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -95,12 +102,17 @@ LdConnectionUniversal::Init()
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
-/// \fn bool LdConnectionUniversal::IsDeviceReady( int32_t aTimeout, int16_t aCRCTry )
+/// \fn bool LdConnectionUniversal::IsDeviceReady( int32_t aTimeout, int16_t aCRCTry, uint8_t aOpCode )
 ///
 /// \brief  Check if the device is ready for read or write.
 ///
-/// \param  aTimeout    The timeout.
+///         The status register is polled again right away a few times, then the delay between polls doubles
+///         up to the device ready timeout (SetDeviceReadyTimeout). The time the device took to become ready is
+///         learned per op code: the next wait after the same command sleeps directly to most of that time.
+///
+/// \param  aTimeout    The timeout in ms.
 /// \param  aCRCTry     The CRC try.
+/// \param  aOpCode     The command just sent, used to learn its latency. 0 for a check before a transaction.
 ///
 /// \return Return true if the device is ready.
 ///
@@ -109,25 +121,72 @@ LdConnectionUniversal::Init()
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 bool
 LdConnectionUniversal::IsDeviceReady( int32_t aTimeout,
-                                      int16_t  aCRCTry )
+                                      int16_t  aCRCTry,
+                                      uint8_t  aOpCode )
 {
-    while( aTimeout > 0 )
+    if( aTimeout <= 0 )
+    {
+        return false;
+    }
+
+    const uint64_t lStart = LeddarUtils::LtTimeUtils::GetMonotonicNanoseconds();
+    const uint64_t lTimeoutUs = static_cast<uint64_t>( aTimeout ) * 1000;
+    const uint32_t lMaxDelayUs = mDeviceReadyTimeout * 1000u;
+    uint32_t lDelayUs = READY_POLL_MIN_DELAY_US;
+    uint32_t lPoll = 0;
+
+    for( ;; )
     {
         try
         {
             if( ( GetStatusRegister( aCRCTry ) & 0x01 ) == 0 )
             {
+                uint64_t lLatencyUs = ( LeddarUtils::LtTimeUtils::GetMonotonicNanoseconds() - lStart ) / 1000;
+                uint32_t lSample = static_cast<uint32_t>( std::min<uint64_t>( std::max<uint64_t>( lLatencyUs, 1 ), lTimeoutUs ) );
+                uint32_t &lLearned = mReadyLatencyUs[ aOpCode ];
+                lLearned = lLearned == 0 ? lSample : static_cast<uint32_t>( ( 3 * static_cast<uint64_t>( lLearned ) + lSample ) / 4 );
                 return true;
             }
         }
         catch( std::exception & )
         {}
 
-        LeddarUtils::LtTimeUtils::Wait( mDeviceReadyTimeout );
-        aTimeout -= mDeviceReadyTimeout;
-    }
+        const uint64_t lElapsedUs = ( LeddarUtils::LtTimeUtils::GetMonotonicNanoseconds() - lStart ) / 1000;
+
+        if( lElapsedUs >= lTimeoutUs )
+        {
+            return false;
+        }
 
-    return false;
+        ++mCounters->mNotReadyPolls;
+
+        if( ++lPoll <= READY_POLL_SPIN_COUNT )
+        {
+            continue;
+        }
+
+        uint64_t lSleepUs = lDelayUs;
+        const uint64_t lExpectedUs = static_cast<uint64_t>( mReadyLatencyUs[ aOpCode ] ) * 3 / 4;
+
+        // Skip the back off to most of the usual latency, the learned value can still decrease
+        if( lPoll == READY_POLL_SPIN_COUNT + 1 && lExpectedUs > lElapsedUs + lSleepUs )
+        {
+            lSleepUs = lExpectedUs - lElapsedUs;
+        }
+
+        lSleepUs = std::min<uint64_t>( std::min<uint64_t>( lSleepUs, std::max<uint32_t>( lMaxDelayUs, READY_POLL_MIN_DELAY_US ) ), lTimeoutUs - lElapsedUs );
+
+        if( lSleepUs < 1000 )
+        {
+            LeddarUtils::LtTimeUtils::WaitBlockingMicro( static_cast<uint32_t>( lSleepUs ) );
+        }
+        else
+        {
+            LeddarUtils::LtTimeUtils::Wait( static_cast<uint32_t>( lSleepUs / 1000 ) );
+        }
+
+        lDelayUs = std::min<uint32_t>( lDelayUs * 2, std::max<uint32_t>( lMaxDelayUs, READY_POLL_MIN_DELAY_US ) );
+    }
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -211,6 +270,60 @@ void LdConnectionUniversal::ReadRegister( const uint32_t &aAddress, uint8_t *aBu
     ReadRegister( aAddress, aBuffer, aSize, 0 );
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LdConnectionUniversal::ReadBlock( uint32_t aAddress, uint8_t *aData, uint32_t aDataSize, int16_t aCRCTry, const int16_t &aIsReadyTimeout, uint32_t aMaxChunkSize )
+///
+/// \brief  Read a memory block larger than the transfer buffer into one contiguous destination.
+///
+///         The block is split in chunks as large as the transport payload (see InternalBuffers) and the transfer buffer allow. Each chunk is copied at its offset in aData.
+///         The device is polled for ready before the first chunk only, the next requests follow right away.
+///         A CRC failure retries the failed chunk only (see Read), not the whole block.
+///
+/// \exception std::invalid_argument  Thrown if aData is null and aDataSize is not 0.
+///
+/// \param          aAddress        Address of the block.
+/// \param [out]    aData           Destination, must hold aDataSize bytes.
+/// \param          aDataSize       Size of the block.
+/// \param          aCRCTry         Number of retry per chunk if CRC check fail. (0 mean no CRC check).
+/// \param          aIsReadyTimeout Timeout of the ready check before the first chunk (0 for no check).
+/// \param          aMaxChunkSize   Maximum size of a chunk, 0 to use the largest size the transport allows.
+///
+/// \author David Levy
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void
+LdConnectionUniversal::ReadBlock( uint32_t aAddress, uint8_t *aData, uint32_t aDataSize, int16_t aCRCTry, const int16_t &aIsReadyTimeout, uint32_t aMaxChunkSize )
+{
+    if( aDataSize == 0 )
+        return;
+
+    if( aData == nullptr )
+    {
+        throw std::invalid_argument( "Invalid destination buffer." );
+    }
+
+    uint8_t *lInputBuffer, *lOutputBuffer;
+    uint32_t lChunkSize = InternalBuffers( lInputBuffer, lOutputBuffer );
+
+    //The transfer buffer can be resized below the transport payload
+    if( mTransferBufferSize < lChunkSize )
+        lChunkSize = mTransferBufferSize;
+
+    if( aMaxChunkSize != 0 && aMaxChunkSize < lChunkSize )
+        lChunkSize = aMaxChunkSize;
+
+    uint32_t lOffset = 0;
+
+    while( lOffset < aDataSize )
+    {
+        uint32_t lSize = aDataSize - lOffset < lChunkSize ? aDataSize - lOffset : lChunkSize;
+
+        Read( REGMAP_READ, aAddress + lOffset, lSize, aCRCTry, lOffset == 0 ? aIsReadyTimeout : 0 );
+        memcpy( aData + lOffset, lOutputBuffer, lSize );
+        lOffset += lSize;
+    }
+}
+
 // *****************************************************************************
 // Function: LdConnectionUniversal::SetAlwaysReadyCheck
 
@@ -40,13 +40,15 @@ namespace LeddarConnection
                                 const int16_t   &aPreIsReadyTimeout = 0, const uint16_t &aWaitAfterOpCode = 0 );
         virtual void     ReadRegister( const uint32_t &aAddress, uint8_t *aBuffer, const uint16_t &aSize );
         virtual void     ReadRegister( const uint32_t &aAddress, uint8_t *aBuffer, const uint16_t &aSize, int16_t aCRCTry );
+        virtual void     ReadBlock( uint32_t aAddress, uint8_t *aData, uint32_t aDataSize, int16_t aCRCTry = 5, const int16_t &aIsReadyTimeout = 0, uint32_t aMaxChunkSize = 0 );
         virtual void     WriteRegister( const uint32_t &aAddress, const uint8_t *aBuffer, const uint16_t &aSize );
         virtual void     WriteRegister( const uint32_t &aAddress, const uint8_t *aBuffer, const uint16_t &aSize, int16_t aCRCTry );
         virtual void     Reset( LeddarDefines::eResetType aType, bool aEnterBootloader ) = 0;
         virtual void     SetAlwaysReadyCheck( bool aValue );
         virtual void     SetWriteEnable( bool aStatus, int16_t aCrcTry = 0 );
         virtual uint8_t  GetStatusRegister( int16_t aCRCTry = 0 );
-        virtual bool     IsDeviceReady( int32_t aTimeout, int16_t aCRCTry = 0 );
+        virtual bool     IsDeviceReady( int32_t aTimeout, int16_t aCRCTry = 0, uint8_t aOpCode = 0 );
+        uint32_t         GetReadyLatency( uint8_t aOpCode ) const { return mReadyLatencyUs[ aOpCode ]; } ///< Learned ready latency of a command in us, 0 if unknown
         virtual bool     IsWriteEnable( int16_t aCrcTry = 0 );
         virtual uint16_t InternalBuffers( uint8_t *( &aInputBuffer ), uint8_t *( &aOutputBuffer ) ) = 0;
 
@@ -58,7 +60,8 @@ namespace LeddarConnection
         bool                mAlwaysReadyCheck;
 
     private:
-        uint16_t mDeviceReadyTimeout;
+        uint16_t mDeviceReadyTimeout;       ///< Maximum delay between polls in ms
+        uint32_t mReadyLatencyUs[ 256 ];    ///< Learned ready latency per op code
     };
 }
 
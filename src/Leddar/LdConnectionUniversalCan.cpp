@@ -136,7 +136,10 @@ void LeddarConnection::LdConnectionUniversalCan::Read( uint8_t aOpCode, uint32_t
         if( ( aIsReadyTimeout > 0 || lIsReadyTimeout ) && aOpCode == 0xb )
         {
             if( !IsDeviceReady( std::max( aIsReadyTimeout, lIsReadyTimeout ) ) )
+            {
+                ++mCounters->mTimeouts;
                 throw LeddarException::LtTimeoutException( "Timeout expired. Device not ready for other operation.", true );
+            }
         }
 
         uint32_t lBytesToReceive = aDataSize;
@@ -167,6 +170,9 @@ void LeddarConnection::LdConnectionUniversalCan::Read( uint8_t aOpCode, uint32_t
                 lCanData.mFrame.Cmd.mArg[0] = aOpCode;
             }
 
+            ++mCounters->mTransactions;
+            mCounters->mBytesOut += LtComCanBus::CAN_DATA_SIZE;
+
             if( !mInterfaceCan->WriteAndWaitForAnswer( dynamic_cast<const LeddarConnection::LdConnectionInfoCan *>( mConnectionInfo )->GetBaseIdRx(),
                     std::vector<uint8_t>( lCanData.mFrame.mRawData, lCanData.mFrame.mRawData + LtComCanBus::CAN_DATA_SIZE ) ) )
             {
@@ -178,10 +184,11 @@ void LeddarConnection::LdConnectionUniversalCan::Read( uint8_t aOpCode, uint32_t
             while( mTransferOutputBuffer[0] == 0 ) //we havent read anything for us yet
             {
                 mInterfaceCan->Read(); //Read something, not necessarily for us
-                LeddarUtils::LtTimeUtils::Wait( 1 );
+                mInterfaceCan->WaitForData( 1 );
 
                 if( lCount-- == 0 )
                 {
+                    ++mCounters->mTimeouts;
                     throw LeddarException::LtTimeoutException( "Timeout waiting for sensor answer reading register " + LeddarUtils::LtStringUtils::IntToString( aAddress, 16 ) );
                 }
             }
@@ -197,6 +204,7 @@ void LeddarConnection::LdConnectionUniversalCan::Read( uint8_t aOpCode, uint32_t
                 lReadSize = aDataSize;
             }
 
+            mCounters->mBytesIn += LtComCanBus::CAN_DATA_SIZE;
             memcpy( &lTempBuffer[aDataSize - lBytesToReceive], &mTransferOutputBuffer[4], lReadSize );
             lBytesToReceive -= lReadSize;
         }
@@ -271,6 +279,9 @@ void LeddarConnection::LdConnectionUniversalCan::Write( uint8_t aOpCode, uint32_
                 lCanData.mFrame.Cmd.mArg[0] = aOpCode;
             }
 
+            ++mCounters->mTransactions;
+            mCounters->mBytesOut += LtComCanBus::CAN_DATA_SIZE;
+
             if( aWaitAfterOpCode == 0 )
             {
                 if( !mInterfaceCan->WriteAndWaitForAnswer( dynamic_cast<const LeddarConnection::LdConnectionInfoCan *>( mConnectionInfo )->GetBaseIdRx(),
@@ -293,8 +304,9 @@ void LeddarConnection::LdConnectionUniversalCan::Write( uint8_t aOpCode, uint32_
 
             if( aPostIsReadyTimeout > 0 )
             {
-                if( !IsDeviceReady( aPostIsReadyTimeout ) )
+                if( !IsDeviceReady( aPostIsReadyTimeout, 0, aOpCode ) )
                 {
+                    ++mCounters->mTimeouts;
                     throw LeddarException::LtTimeoutException( "Timeout expired. Device not ready for other operation.", true );
                 }
             }
@@ -268,8 +268,11 @@ LdConnectionUniversalModbus::Read( uint8_t aOpCode, uint32_t aAddress,
         const uint16_t lTimeout = std::max( aIsReadyTimeout, lIsReadyTimeout );
 
         if( !IsDeviceReady( lTimeout ) )
+        {
+            ++mCounters->mTimeouts;
             throw LeddarException::LtTimeoutException( "(LdConnectionUniversalModbus::Read) Timeout expired. Device not ready for other operation ( timeout: " + LeddarUtils::LtStringUtils::IntToString(
                         lTimeout ) + " ).", true );
+        }
 
     }
 
@@ -304,8 +307,11 @@ LdConnectionUniversalModbus::Read( uint8_t aOpCode, uint32_t aAddress,
                                        offsetof( LdConnectionModbuStructures::sModbusReadDataAnswer, mData ) +
                                        MODBUS_CRC_SIZE );
 
+                    ++mCounters->mTransactions;
                     mInterfaceModbus->SendRawRequest( ( uint8_t * )&lReceiveBuffer, lOutSize );
+                    mCounters->mBytesOut += lOutSize;
                     lRet = mInterfaceModbus->ReceiveRawConfirmation( ( uint8_t * )&lAnswerBuffer, lInSize + lReceiveBuffer.uRequest.mReadData.mNumberOfBytesToRead );
+                    mCounters->mBytesIn += lRet;
 
                     if( lRet < lReceiveBuffer.uRequest.mReadData.mNumberOfBytesToRead )
                         throw LeddarException::LtComException( "Missing bytes in modbus packet." );
@@ -313,12 +319,34 @@ LdConnectionUniversalModbus::Read( uint8_t aOpCode, uint32_t aAddress,
                     break;
 
                 }
+                catch( LeddarException::LtTimeoutException & )
+                {
+                    ++mCounters->mTimeouts;
+                    aCRCTry--;
+
+                    if( aCRCTry < 0 )
+                        throw;
+
+                    ++mCounters->mCrcRetries;
+                }
+                catch( LeddarException::LtCrcException & )
+                {
+                    ++mCounters->mCrcFailures;
+                    aCRCTry--;
+
+                    if( aCRCTry < 0 )
+                        throw;
+
+                    ++mCounters->mCrcRetries;
+                }
                 catch( ... )
                 {
                     aCRCTry--;
 
                     if( aCRCTry < 0 )
                         throw;
+
+                    ++mCounters->mCrcRetries;
                 }
             }
 
@@ -344,16 +372,40 @@ LdConnectionUniversalModbus::Read( uint8_t aOpCode, uint32_t aAddress,
         {
             try
             {
+                ++mCounters->mTransactions;
                 mInterfaceModbus->SendRawRequest( ( uint8_t * )&lReceiveBuffer, lOutSize );
-                mInterfaceModbus->ReceiveRawConfirmation( ( uint8_t * )&lAnswerBuffer, lInSize );
+                mCounters->mBytesOut += lOutSize;
+                mCounters->mBytesIn += mInterfaceModbus->ReceiveRawConfirmation( ( uint8_t * )&lAnswerBuffer, lInSize );
                 break;
             }
+            catch( LeddarException::LtTimeoutException & )
+            {
+                ++mCounters->mTimeouts;
+                aCRCTry--;
+
+                if( aCRCTry < 0 )
+                    throw;
+
+                ++mCounters->mCrcRetries;
+            }
+            catch( LeddarException::LtCrcException & )
+            {
+                ++mCounters->mCrcFailures;
+                aCRCTry--;
+
+                if( aCRCTry < 0 )
+                    throw;
+
+                ++mCounters->mCrcRetries;
+            }
             catch( ... )
             {
                 aCRCTry--;
 
                 if( aCRCTry < 0 )
                     throw;
+
+                ++mCounters->mCrcRetries;
             }
         }
 
@@ -412,16 +464,19 @@ LdConnectionUniversalModbus::Write( uint8_t aOpCode, uint32_t aAddress, const ui
             lWriteBuffer.uRequest.mWriteData.mBaseAddress           = aAddress + lBytesWritten;
             memcpy( lWriteBuffer.uRequest.mWriteData.mData, mTransferInputBuffer + lBytesWritten, lWriteBuffer.uRequest.mWriteData.mNumberOfBytesToWrite );
 
+            ++mCounters->mTransactions;
             mInterfaceModbus->SendRawRequest( ( uint8_t * )&lWriteBuffer, lOutSize + lWriteBuffer.uRequest.mWriteData.mNumberOfBytesToWrite );
-            mInterfaceModbus->ReceiveRawConfirmation( ( uint8_t * )&lAnswerBuffer, lInSize );
+            mCounters->mBytesOut += lOutSize + lWriteBuffer.uRequest.mWriteData.mNumberOfBytesToWrite;
+            mCounters->mBytesIn += mInterfaceModbus->ReceiveRawConfirmation( ( uint8_t * )&lAnswerBuffer, lInSize );
 
             lBytesWritten += lWriteBuffer.uRequest.mWriteData.mNumberOfBytesToWrite;
             lBytesToWrite -= lWriteBuffer.uRequest.mWriteData.mNumberOfBytesToWrite;
 
             if( aPostIsReadyTimeout > 0 )
             {
-                if( !IsDeviceReady( aPostIsReadyTimeout ) )
+                if( !IsDeviceReady( aPostIsReadyTimeout, 0, aOpCode ) )
                 {
+                    ++mCounters->mTimeouts;
                     throw LeddarException::LtTimeoutException( "(LdConnectionUniversalModbus::Write) Timeout expired. Device not ready for other operation ( timeout: " + LeddarUtils::LtStringUtils::IntToString(
                                 aPostIsReadyTimeout ) + " ).", true );
                 }
@@ -442,8 +497,10 @@ LdConnectionUniversalModbus::Write( uint8_t aOpCode, uint32_t aAddress, const ui
         lWriteBuffer.uRequest.mSendOpCode.mOptionalArg  = 0;
         memcpy( &lWriteBuffer.uRequest.mSendOpCode.mOptionalArg, mTransferInputBuffer, aDataSize );
 
+        ++mCounters->mTransactions;
         mInterfaceModbus->SendRawRequest( ( uint8_t * )&lWriteBuffer, lOutSize );
-        mInterfaceModbus->ReceiveRawConfirmation( ( uint8_t * )&lAnswerBuffer, lInSize );
+        mCounters->mBytesOut += lOutSize;
+        mCounters->mBytesIn += mInterfaceModbus->ReceiveRawConfirmation( ( uint8_t * )&lAnswerBuffer, lInSize );
 
         if( aWaitAfterOpCode > 0 )
         {
@@ -193,13 +193,18 @@ LdConnectionUniversalSpi::Read( uint8_t         aOpCode,
         throw LeddarException::LtNotConnectedException( "SPI device not connected." );
     }
 
+    LT_TIMING_BEGIN( lStart );
+
     // Check if device is ready (only for 0xb opcode)
     int16_t lIsReadyTimeout = this->mAlwaysReadyCheck ? 5000 : 0;
 
     if( ( aIsReadyTimeout > 0 || lIsReadyTimeout ) && aOpCode == 0xb )
     {
         if( !IsDeviceReady( std::max( aIsReadyTimeout, lIsReadyTimeout ) ) )
+        {
+            ++mCounters->mTimeouts;
             throw LeddarException::LtTimeoutException( "Timeout expired. Device not ready for other operation.", true );
+        }
     }
 
     // Addresses and data sizes are in big endian with the Universal protocol SPI
@@ -230,6 +235,9 @@ LdConnectionUniversalSpi::Read( uint8_t         aOpCode,
 
         // Clock to get the payload
         mSpiInterface->Read( mTransferOutputBuffer + HEADER_SIZE, aDataSize + CRC_SIZE, true );
+        ++mCounters->mTransactions;
+        mCounters->mBytesOut += HEADER_SIZE;
+        mCounters->mBytesIn += aDataSize + CRC_SIZE;
 
         // Check crc
         uint16_t lCrc16 = ( ( *( mTransferOutputBuffer + HEADER_SIZE + aDataSize ) ) << 8 ) + *( mTransferOutputBuffer + HEADER_SIZE + aDataSize + 1 );
@@ -239,10 +247,13 @@ LdConnectionUniversalSpi::Read( uint8_t         aOpCode,
             try
             {
                 CrcCheck( mTransferInputBuffer, mTransferOutputBuffer + HEADER_SIZE, aDataSize, lCrc16 );
+                LT_TIMING_END( mTimingStats, TS_TRANSPORT_READ, lStart );
                 return;
             }
             catch( LeddarException::LtComException &e )
             {
+                ++mCounters->mCrcFailures;
+
                 if( aCRCTry <= 1 )
                 {
                     e.SetExtraInformation( "Read address: 0x"
@@ -250,6 +261,8 @@ LdConnectionUniversalSpi::Read( uint8_t         aOpCode,
                                            + " size: " + LeddarUtils::LtStringUtils::IntToString( aDataSize ) );
                     throw;
                 }
+
+                ++mCounters->mCrcRetries;
             }
 
             LeddarUtils::LtTimeUtils::Wait( 1 );
@@ -257,6 +270,8 @@ LdConnectionUniversalSpi::Read( uint8_t         aOpCode,
 
         --aCRCTry;
     }
+
+    LT_TIMING_END( mTimingStats, TS_TRANSPORT_READ, lStart );
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -302,7 +317,10 @@ LdConnectionUniversalSpi::Write( uint8_t          aOpCode,
     if( ( aPreIsReadyTimeout > 0 || lIsReadyTimeout ) && aOpCode == 0xb )
     {
         if( !IsDeviceReady( std::max( aPreIsReadyTimeout, lIsReadyTimeout ) ) )
+        {
+            ++mCounters->mTimeouts;
             throw LeddarException::LtTimeoutException( "Timeout expired. Device not ready for other operation.", true );
+        }
     }
 
     uint32_t lBytes2Send = aDataSize;
@@ -340,6 +358,8 @@ LdConnectionUniversalSpi::Write( uint8_t          aOpCode,
 
             memcpy( lWriteBuffer + HEADER_SIZE + lBytesSend, &lCrc16, CRC_SIZE );
             mSpiInterface->Transfert( lWriteBuffer, mTransferOutputBuffer, HEADER_SIZE + lBytesSend + CRC_SIZE, true );
+            ++mCounters->mTransactions;
+            mCounters->mBytesOut += HEADER_SIZE + lBytesSend + CRC_SIZE;
 
             if( aWaitAfterOpCode > 0 )
             {
@@ -348,8 +368,9 @@ LdConnectionUniversalSpi::Write( uint8_t          aOpCode,
 
             if( aPostIsReadyTimeout > 0 )
             {
-                if( !IsDeviceReady( aPostIsReadyTimeout ) )
+                if( !IsDeviceReady( aPostIsReadyTimeout, 0, aOpCode ) )
                 {
+                    ++mCounters->mTimeouts;
                     throw LeddarException::LtTimeoutException( "Timeout expired. Device not ready for other operation.", true );
                 }
             }
@@ -362,6 +383,8 @@ LdConnectionUniversalSpi::Write( uint8_t          aOpCode,
 
                 if( lTransactionInfo != REGMAP_NO_ERR )
                 {
+                    ++mCounters->mCrcFailures;
+
                     if( lCRCTry <= 1 )
                     {
                         throw LeddarException::LtComException( "Write operation failed: " + GetErrorInfo( lTransactionInfo ) + ". Address: "
@@ -369,6 +392,7 @@ LdConnectionUniversalSpi::Write( uint8_t          aOpCode,
                                                                + " size: " + LeddarUtils::LtStringUtils::IntToString( aDataSize ) );
                     }
 
+                    ++mCounters->mCrcRetries;
                     LeddarUtils::LtTimeUtils::Wait( 10 );
 
                 }
@@ -499,6 +523,31 @@ LdConnectionUniversalSpi::InternalBuffers( uint8_t *( &aInputBuffer ), uint8_t *
     return SPI_UNIVERSAL_PAYLOAD_SIZE;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LdConnectionUniversalSpi::ResizeInternalBuffers( const uint32_t &aSize )
+///
+/// \brief  Resize the internal buffers, keeping the room for the header and the CRC of a transaction.
+///
+/// \param  aSize   Size of the payload to receive.
+///
+/// \author David Levy
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void
+LdConnectionUniversalSpi::ResizeInternalBuffers( const uint32_t &aSize )
+{
+    uint8_t *lInputBuffer = new uint8_t[aSize + OVERHEAD_SIZE];
+    uint8_t *lOutputBuffer = new uint8_t[aSize + OVERHEAD_SIZE];
+    uint32_t lCopySize = ( aSize > mTransferBufferSize ? mTransferBufferSize : aSize ) + OVERHEAD_SIZE;
+    memcpy( lInputBuffer, mTransferInputBuffer, lCopySize );
+    memcpy( lOutputBuffer, mTransferOutputBuffer, lCopySize );
+    delete[] mTransferInputBuffer;
+    delete[] mTransferOutputBuffer;
+    mTransferInputBuffer = lInputBuffer;
+    mTransferOutputBuffer = lOutputBuffer;
+    mTransferBufferSize = aSize;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// \fn void LdConnectionUniversalSpi::CrcCheck( uint8_t *aHeader, uint8_t *aData, const uint32_t &aDataSize, uint16_t aCrc16 )
 ///
@@ -37,6 +37,7 @@ namespace LeddarConnection
 
         virtual void     Reset( LeddarDefines::eResetType aType, bool aEnterBootloader ) override;
         virtual uint16_t InternalBuffers( uint8_t *( &aInputBuffer ), uint8_t *( &aOutputBuffer ) ) override;
+        virtual void     ResizeInternalBuffers( const uint32_t &aSize ) override;
 
     protected:
         virtual void     CrcCheck( uint8_t *aHeader, uint8_t *aData, const uint32_t &aDataSize, uint16_t aCrc16 );
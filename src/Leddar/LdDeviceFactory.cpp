@@ -31,6 +31,66 @@
 
 using namespace LeddarDevice;
 
+namespace
+{
+#ifdef BUILD_MODBUS
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn bool IsModbusConnection( const LeddarConnection::LdConnection *aConnection )
+    ///
+    /// \brief  Check if the connection is a Modbus one (serial or TCP)
+    ///
+    /// \param  aConnection The connection, can be nullptr.
+    ///
+    /// \author David Levy
+    /// \date   October 2026
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    bool IsModbusConnection( const LeddarConnection::LdConnection *aConnection )
+    {
+        return aConnection != nullptr && ( aConnection->GetConnectionInfo()->GetType() == LeddarConnection::LdConnectionInfo::CT_LIB_MODBUS ||
+                                           aConnection->GetConnectionInfo()->GetType() == LeddarConnection::LdConnectionInfo::CT_LIB_MODBUS_TCP );
+    }
+#endif
+
+#ifdef BUILD_CANBUS
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn bool IsCanConnection( const LeddarConnection::LdConnection *aConnection )
+    ///
+    /// \brief  Check if the connection goes through one of the CANbus adapters
+    ///
+    /// \param  aConnection The connection, can be nullptr.
+    ///
+    /// \author David Levy
+    /// \date   October 2026
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    bool IsCanConnection( const LeddarConnection::LdConnection *aConnection )
+    {
+        if( aConnection == nullptr )
+        {
+            return false;
+        }
+
+        LeddarConnection::LdConnectionInfo::eConnectionType lType = aConnection->GetConnectionInfo()->GetType();
+#ifdef BUILD_CANBUS_KOMODO
+
+        if( lType == LeddarConnection::LdConnectionInfo::CT_CAN_KOMODO )
+        {
+            return true;
+        }
+
+#endif
+#ifdef BUILD_CANBUS_SOCKETCAN
+
+        if( lType == LeddarConnection::LdConnectionInfo::CT_CAN_SOCKETCAN )
+        {
+            return true;
+        }
+
+#endif
+        return false;
+    }
+#endif
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// \fn LdSensor * LdDeviceFactory::CreateSensor( LeddarConnection::LdConnection *aConnection )
 ///
@@ -85,14 +145,14 @@ LdSensor *LeddarDevice::LdDeviceFactory::CreateSensorFromDeviceType( uint32_t aD
     if( aDeviceType == LtComLeddarTechPublic::LT_COMM_DEVICE_TYPE_VU8 )
     {
         if( aConnection &&
-                ( aConnection->GetConnectionInfo()->GetType() == LeddarConnection::LdConnectionInfo::CT_LIB_MODBUS ||
+                ( IsModbusConnection( aConnection ) ||
                   aConnection->GetConnectionInfo()->GetType() == LeddarConnection::LdConnectionInfo::CT_SPI_FTDI ) )
         {
             LeddarDevice::LdSensorVu8 *lSensor = new LdSensorVu8( aConnection );
 
 #ifdef BUILD_MODBUS
 
-            if( aConnection && aConnection->GetConnectionInfo()->GetType() == LeddarConnection::LdConnectionInfo::CT_LIB_MODBUS )
+            if( IsModbusConnection( aConnection ) )
             {
                 lSensor->SetCarrier( new LdCarrierEnhancedModbus( aConnection ) );
             }
@@ -103,7 +163,7 @@ LdSensor *LeddarDevice::LdDeviceFactory::CreateSensorFromDeviceType( uint32_t aD
 
 #ifdef BUILD_CANBUS
 
-        if( aConnection && aConnection->GetConnectionInfo()->GetType() == LeddarConnection::LdConnectionInfo::CT_CAN_KOMODO )
+        if( IsCanConnection( aConnection ) )
         {
             return new LeddarDevice::LdSensorVu8Can( aConnection );
         }
@@ -132,7 +192,7 @@ LdSensor *LeddarDevice::LdDeviceFactory::CreateSensorFromDeviceType( uint32_t aD
 #endif
 #if defined(BUILD_MODBUS)
 
-        if( aConnection && aConnection->GetConnectionInfo()->GetType() == LeddarConnection::LdConnectionInfo::CT_LIB_MODBUS )
+        if( IsModbusConnection( aConnection ) )
         {
             return new LdSensorM16Modbus( aConnection );
         }
@@ -140,7 +200,7 @@ LdSensor *LeddarDevice::LdDeviceFactory::CreateSensorFromDeviceType( uint32_t aD
 #endif
 #ifdef BUILD_CANBUS
 
-        if( aConnection && aConnection->GetConnectionInfo()->GetType() == LeddarConnection::LdConnectionInfo::CT_CAN_KOMODO )
+        if( IsCanConnection( aConnection ) )
         {
             return new LeddarDevice::LdSensorM16Can( aConnection );
         }
@@ -157,7 +217,7 @@ LdSensor *LeddarDevice::LdDeviceFactory::CreateSensorFromDeviceType( uint32_t aD
 #endif
 #if defined(BUILD_MODBUS)
 
-        if( aConnection && aConnection->GetConnectionInfo()->GetType() == LeddarConnection::LdConnectionInfo::CT_LIB_MODBUS )
+        if( IsModbusConnection( aConnection ) )
         {
             return new LdSensorM16Modbus( aConnection );
         }
@@ -165,7 +225,7 @@ LdSensor *LeddarDevice::LdDeviceFactory::CreateSensorFromDeviceType( uint32_t aD
 #endif
 #ifdef BUILD_CANBUS
 
-        if( aConnection && aConnection->GetConnectionInfo()->GetType() == LeddarConnection::LdConnectionInfo::CT_CAN_KOMODO )
+        if( IsCanConnection( aConnection ) )
         {
             return new LeddarDevice::LdSensorM16Can( aConnection );
         }
@@ -182,7 +242,7 @@ LdSensor *LeddarDevice::LdDeviceFactory::CreateSensorFromDeviceType( uint32_t aD
 #endif
 #if defined(BUILD_MODBUS)
 
-        if( aConnection && aConnection->GetConnectionInfo()->GetType() == LeddarConnection::LdConnectionInfo::CT_LIB_MODBUS )
+        if( IsModbusConnection( aConnection ) )
         {
             return new LdSensorM16Modbus( aConnection );
         }
@@ -190,7 +250,7 @@ LdSensor *LeddarDevice::LdDeviceFactory::CreateSensorFromDeviceType( uint32_t aD
 #endif
 #ifdef BUILD_CANBUS
 
-        if( aConnection && aConnection->GetConnectionInfo()->GetType() == LeddarConnection::LdConnectionInfo::CT_CAN_KOMODO )
+        if( IsCanConnection( aConnection ) )
         {
             return new LeddarDevice::LdSensorM16Can( aConnection );
         }
@@ -482,6 +482,11 @@ void
 LeddarConnection::LdEthernet::CloseUDPSocket( void )
 {
     CloseSocket( mUDPSocket );
+#ifdef _WIN32
+    mUDPSocket = INVALID_SOCKET;
+#else
+    mUDPSocket = 0;
+#endif
 }
 
 // *****************************************************************************
@@ -990,6 +995,95 @@ LeddarConnection::LdEthernet::ReceiveFrom( std::string &aIpAddress, uint16_t &aP
     return static_cast<uint32_t>( lResult );
 }
 
+#ifndef _WIN32
+// *****************************************************************************
+// Function: LdEthernet::TryReceive
+//
+/// \brief   Read the data available on the TCP socket without blocking
+///
+/// \param   aBuffer Buffer to receive the data.
+/// \param   aSize   Size of the buffer.
+///
+/// \return  Number of bytes received, 0 if no data is available
+///
+/// \exception LtComException when the connection is closed or recv fail
+///
+/// \author  David Levy
+///
+/// \since   October 2026
+// *****************************************************************************
+size_t
+LeddarConnection::LdEthernet::TryReceive( uint8_t *aBuffer, uint32_t aSize )
+{
+    ssize_t lBytesReceived = recv( mSocket, ( char * )aBuffer, aSize, MSG_DONTWAIT );
+
+    if( lBytesReceived == 0 )
+    {
+        throw LeddarException::LtComException( "Error in Receive ( connection close ).", 0, true );
+    }
+    else if( lBytesReceived < 0 )
+    {
+        if( EAGAIN == LAST_ERROR || EWOULDBLOCK == LAST_ERROR || EINTR == LAST_ERROR )
+        {
+            return 0;
+        }
+        else if( ECONNABORTED == LAST_ERROR || ECONNRESET == LAST_ERROR )
+        {
+            throw LeddarException::LtComException( "Error in Receive (connection close.).", 0, true );
+        }
+        else
+        {
+            throw LeddarException::LtComException( "Error in Receive (recv): " + LeddarUtils::LtStringUtils::IntToString( LAST_ERROR ),
+                                                   LeddarException::ERROR_COM_READ );
+        }
+    }
+
+    return static_cast<size_t>( lBytesReceived );
+}
+
+// *****************************************************************************
+// Function: LdEthernet::TryReceiveFrom
+//
+/// \brief   Read one datagram from the UDP socket without blocking
+///
+/// \param   aIpAddress The IPV4 address of the sender of the received packet.
+/// \param   aPort      The port number where the data originated.
+/// \param   aData      Buffer to receive the data.
+/// \param   aSize      Size of the buffer.
+///
+/// \return  Number of bytes received, 0 if no datagram is available
+///
+/// \exception LtComException when the recvfrom fail
+///
+/// \author  David Levy
+///
+/// \since   October 2026
+// *****************************************************************************
+uint32_t
+LeddarConnection::LdEthernet::TryReceiveFrom( std::string &aIpAddress, uint16_t &aPort, uint8_t *aData, uint32_t aSize )
+{
+    sockaddr_in lAddress = {};
+    socklen_t lAddressSize = sizeof( lAddress );
+
+    const ssize_t lResult = recvfrom( mUDPSocket, ( char * )aData, aSize, MSG_DONTWAIT, ( sockaddr * )&lAddress, &lAddressSize );
+
+    if( lResult < 0 )
+    {
+        if( EAGAIN == LAST_ERROR || EWOULDBLOCK == LAST_ERROR || EINTR == LAST_ERROR )
+        {
+            return 0;
+        }
+
+        throw LeddarException::LtComException( "Error to receive UDP data (" + LeddarUtils::LtStringUtils::IntToString( LAST_ERROR ) + ")" );
+    }
+
+    aIpAddress = LeddarUtils::LtStringUtils::Ip4AddrToString( lAddress.sin_addr.s_addr );
+    aPort = ntohs( lAddress.sin_port );
+
+    return static_cast<uint32_t>( lResult );
+}
+#endif
+
 // *****************************************************************************
 // Function: LdEthernet::FlushBuffer
 //
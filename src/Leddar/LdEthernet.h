@@ -51,6 +51,14 @@ namespace LeddarConnection
         virtual void     CloseUDPSocket( void ) override;
         static void CloseSocket( const SOCKET aSocket );
 
+#ifndef _WIN32
+        // Non-blocking reads, used by LdEthernetReactor
+        size_t   TryReceive( uint8_t *aBuffer, uint32_t aSize );
+        uint32_t TryReceiveFrom( std::string &aIpAddress, uint16_t &aPort, uint8_t *aData, uint32_t aSize );
+#endif
+        SOCKET   GetSocket( void ) const { return mSocket; }
+        SOCKET   GetUDPSocket( void ) const { return mUDPSocket; }
+
         static std::vector<std::pair<SOCKET, unsigned long> > OpenScanRequestSockets();
         static void GetDevicesListSendRequest( const std::vector<std::pair<SOCKET, unsigned long> > &aInterfaces, bool aWideBroadcast = false );
         static std::vector<LeddarConnection::LdConnectionInfo *> GetDevicesListReadAnswer( const std::vector<std::pair<SOCKET, unsigned long> > &aInterfaces );
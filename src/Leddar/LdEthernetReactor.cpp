@@ -0,0 +1,443 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \file   Leddar/LdEthernetReactor.cpp
+///
+/// \brief  Implements the LdEthernetReactor class
+///
+/// Copyright (c) 2018 LeddarTech. All rights reserved.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "LdEthernetReactor.h"
+#if defined(BUILD_ETHERNET) && !defined(_WIN32)
+
+#include "LtExceptions.h"
+#include "LtStringUtils.h"
+
+#include <cassert>
+#include <cerrno>
+#include <exception>
+#include <stdexcept>
+
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+namespace
+{
+    const int MAX_EVENTS = 32;
+    const int MAX_READS_PER_EVENT = 16; ///< So one busy socket does not starve the others
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn LeddarConnection::LdEthernetReactor::LdEthernetReactor( size_t aBufferSize )
+///
+/// \brief  Constructor. The thread is started by Start.
+///
+/// \exception  LtComException  Thrown if the epoll instance cannot be created.
+///
+/// \param  aBufferSize Size of the receive buffer, must hold the largest datagram.
+///
+/// \author David Levy
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+LeddarConnection::LdEthernetReactor::LdEthernetReactor( size_t aBufferSize ) :
+    mEpoll( -1 ),
+    mWakeUp( -1 ),
+    mBuffer( aBufferSize ),
+    mRunning( false )
+{
+    mEpoll = epoll_create1( EPOLL_CLOEXEC );
+
+    if( mEpoll < 0 )
+    {
+        throw LeddarException::LtComException( "Failed to create epoll instance: " + LeddarUtils::LtStringUtils::IntToString( errno ) );
+    }
+
+    mWakeUp = eventfd( 0, EFD_NONBLOCK | EFD_CLOEXEC );
+
+    struct epoll_event lEvent = {};
+    lEvent.events = EPOLLIN;
+    lEvent.data.fd = mWakeUp;
+
+    if( mWakeUp < 0 || epoll_ctl( mEpoll, EPOLL_CTL_ADD, mWakeUp, &lEvent ) < 0 )
+    {
+        int lError = errno;
+
+        if( mWakeUp >= 0 )
+            close( mWakeUp );
+
+        close( mEpoll );
+        throw LeddarException::LtComException( "Failed to create reactor wake up event: " + LeddarUtils::LtStringUtils::IntToString( lError ) );
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn LeddarConnection::LdEthernetReactor::~LdEthernetReactor()
+///
+/// \brief  Destructor. Stops the thread. The connections are not closed.
+///         Must not be called from a callback: the reactor thread still uses the object when the callback returns.
+///         Call Stop from the callback and delete the reactor from another thread instead.
+///
+/// \author David Levy
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+LeddarConnection::LdEthernetReactor::~LdEthernetReactor()
+{
+    if( mThread.joinable() && mThread.get_id() == std::this_thread::get_id() )
+    {
+        assert( false ); //Deleted from a callback
+        std::terminate();
+    }
+
+    Stop();
+    close( mWakeUp );
+    close( mEpoll );
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LeddarConnection::LdEthernetReactor::Add( LdEthernet *aConnection, Handler *aHandler )
+///
+/// \brief  Registers the TCP socket (if connected) and the UDP socket (if opened) of the connection.
+///
+/// \exception  std::invalid_argument   Thrown if an argument is null, the connection has no open socket or is already registered.
+/// \exception  LtComException          Thrown if epoll_ctl fails.
+///
+/// \param [in] aConnection The connection.
+/// \param [in] aHandler    The handler called from the reactor thread. Must live until the connection is removed.
+///
+/// \author David Levy
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void
+LeddarConnection::LdEthernetReactor::Add( LdEthernet *aConnection, Handler *aHandler )
+{
+    if( aConnection == nullptr || aHandler == nullptr )
+    {
+        throw std::invalid_argument( "Invalid connection or handler." );
+    }
+
+    std::vector<sEntry> lEntries;
+
+    if( aConnection->IsConnected() )
+    {
+        sEntry lEntry = { aConnection, aHandler, false };
+        lEntries.push_back( lEntry );
+    }
+
+    if( aConnection->GetUDPSocket() > 0 )
+    {
+        sEntry lEntry = { aConnection, aHandler, true };
+        lEntries.push_back( lEntry );
+    }
+
+    if( lEntries.empty() )
+    {
+        throw std::invalid_argument( "Connection has no open socket." );
+    }
+
+    std::lock_guard<std::recursive_mutex> lLock( mMutex );
+
+    for( std::map<int, sEntry>::const_iterator lIter = mEntries.begin(); lIter != mEntries.end(); ++lIter )
+    {
+        if( lIter->second.mConnection == aConnection )
+        {
+            throw std::invalid_argument( "Connection already registered." );
+        }
+    }
+
+    for( size_t i = 0; i < lEntries.size(); ++i )
+    {
+        int lFd = lEntries[i].mUDP ? aConnection->GetUDPSocket() : aConnection->GetSocket();
+
+        struct epoll_event lEvent = {};
+        lEvent.events = EPOLLIN;
+        lEvent.data.fd = lFd;
+
+        if( epoll_ctl( mEpoll, EPOLL_CTL_ADD, lFd, &lEvent ) < 0 )
+        {
+            int lError = errno;
+            RemoveLocked( aConnection );
+            throw LeddarException::LtComException( "Failed to add socket to epoll: " + LeddarUtils::LtStringUtils::IntToString( lError ) );
+        }
+
+        mEntries[lFd] = lEntries[i];
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LeddarConnection::LdEthernetReactor::Remove( LdEthernet *aConnection )
+///
+/// \brief  Unregisters the sockets of the connection. Waits for a running callback to finish (unless called from it).
+///         Must be called before the sockets are closed.
+///
+/// \param [in] aConnection The connection.
+///
+/// \author David Levy
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void
+LeddarConnection::LdEthernetReactor::Remove( LdEthernet *aConnection )
+{
+    std::lock_guard<std::recursive_mutex> lLock( mMutex );
+    RemoveLocked( aConnection );
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LeddarConnection::LdEthernetReactor::RemoveLocked( LdEthernet *aConnection )
+///
+/// \brief  Unregisters the sockets of the connection, mMutex must be held.
+///
+/// \param [in] aConnection The connection.
+///
+/// \author David Levy
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void
+LeddarConnection::LdEthernetReactor::RemoveLocked( LdEthernet *aConnection )
+{
+    std::map<int, sEntry>::iterator lIter = mEntries.begin();
+
+    while( lIter != mEntries.end() )
+    {
+        if( lIter->second.mConnection == aConnection )
+        {
+            epoll_ctl( mEpoll, EPOLL_CTL_DEL, lIter->first, nullptr );
+            lIter = mEntries.erase( lIter );
+        }
+        else
+        {
+            ++lIter;
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn size_t LeddarConnection::LdEthernetReactor::GetConnectionCount( void )
+///
+/// \brief  Number of registered sockets (a connection with TCP and UDP counts twice).
+///
+/// \author David Levy
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+size_t
+LeddarConnection::LdEthernetReactor::GetConnectionCount( void )
+{
+    std::lock_guard<std::recursive_mutex> lLock( mMutex );
+    return mEntries.size();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LeddarConnection::LdEthernetReactor::Start( void )
+///
+/// \brief  Starts the reactor thread. Does nothing if it is already running.
+///
+/// \exception  std::logic_error    Thrown if called from a callback after Stop, the reactor thread would join itself.
+///
+/// \author David Levy
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void
+LeddarConnection::LdEthernetReactor::Start( void )
+{
+    if( mRunning )
+        return;
+
+    if( mThread.joinable() )
+    {
+        if( mThread.get_id() == std::this_thread::get_id() )
+        {
+            throw std::logic_error( "Start cannot be called from a reactor callback once the reactor is stopped." );
+        }
+
+        mThread.join();
+    }
+
+    mRunning = true;
+    mThread = std::thread( &LdEthernetReactor::Run, this );
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LeddarConnection::LdEthernetReactor::Stop( void )
+///
+/// \brief  Stops the reactor thread and waits for it, unless called from a callback.
+///         Connections stay registered, Start resumes the dispatch.
+///
+/// \author David Levy
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void
+LeddarConnection::LdEthernetReactor::Stop( void )
+{
+    mRunning = false;
+
+    uint64_t lValue = 1;
+
+    if( write( mWakeUp, &lValue, sizeof( lValue ) ) < 0 )
+    {
+        //Counter already set, the thread will wake up anyway
+    }
+
+    if( mThread.joinable() && mThread.get_id() != std::this_thread::get_id() )
+        mThread.join();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LeddarConnection::LdEthernetReactor::Run( void )
+///
+/// \brief  Reactor thread: waits for readable sockets and dispatches them.
+///         If epoll_wait fails, the reactor stops and every handler gets an OnError starting with "Reactor error: ".
+///
+/// \author David Levy
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void
+LeddarConnection::LdEthernetReactor::Run( void )
+{
+    struct epoll_event lEvents[MAX_EVENTS];
+
+    while( mRunning )
+    {
+        int lCount = epoll_wait( mEpoll, lEvents, MAX_EVENTS, -1 );
+
+        if( lCount < 0 )
+        {
+            int lError = errno;
+
+            if( lError == EINTR )
+                continue;
+
+            //The reactor is dead: say so (IsRunning, Start restarts it) and tell every handler, the connections stay registered
+            mRunning = false;
+
+            std::lock_guard<std::recursive_mutex> lLock( mMutex );
+            std::vector<sEntry> lEntries;
+
+            for( std::map<int, sEntry>::const_iterator lIter = mEntries.begin(); lIter != mEntries.end(); ++lIter )
+            {
+                lEntries.push_back( lIter->second );
+            }
+
+            for( size_t i = 0; i < lEntries.size(); ++i )
+            {
+                ReportError( lEntries[i], "Reactor error: epoll_wait failed, errno " + LeddarUtils::LtStringUtils::IntToString( lError ) );
+            }
+
+            return;
+        }
+
+        for( int i = 0; i < lCount && mRunning; ++i )
+        {
+            if( lEvents[i].data.fd == mWakeUp )
+            {
+                uint64_t lValue;
+
+                if( read( mWakeUp, &lValue, sizeof( lValue ) ) < 0 )
+                {
+                    //Already reset
+                }
+
+                continue;
+            }
+
+            Dispatch( lEvents[i].data.fd );
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LeddarConnection::LdEthernetReactor::Dispatch( int aFd )
+///
+/// \brief  Reads the available data of a socket and calls the handler.
+///         On a socket error, the connection is removed before calling Handler::OnError.
+///         An exception thrown by OnReceive / OnReceiveFrom is also given to OnError, but the connection stays registered.
+///
+/// \param  aFd The readable socket.
+///
+/// \author David Levy
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void
+LeddarConnection::LdEthernetReactor::Dispatch( int aFd )
+{
+    std::lock_guard<std::recursive_mutex> lLock( mMutex );
+
+    for( int lRead = 0; lRead < MAX_READS_PER_EVENT; ++lRead )
+    {
+        //Look up at each iteration, the callback may have removed the connection
+        std::map<int, sEntry>::const_iterator lIter = mEntries.find( aFd );
+
+        if( lIter == mEntries.end() )
+            return;
+
+        sEntry lEntry = lIter->second;
+        std::string lIpAddress;
+        uint16_t lPort = 0;
+        size_t lSize = 0;
+
+        try
+        {
+            if( lEntry.mUDP )
+            {
+                lSize = lEntry.mConnection->TryReceiveFrom( lIpAddress, lPort, &mBuffer[0], static_cast<uint32_t>( mBuffer.size() ) );
+            }
+            else
+            {
+                lSize = lEntry.mConnection->TryReceive( &mBuffer[0], static_cast<uint32_t>( mBuffer.size() ) );
+            }
+        }
+        catch( LeddarException::LtComException &e )
+        {
+            RemoveLocked( lEntry.mConnection );
+            ReportError( lEntry, e.what() );
+            return;
+        }
+
+        if( lSize == 0 )
+            return;
+
+        //An exception from the handler is not a socket failure, the connection stays registered
+        try
+        {
+            if( lEntry.mUDP )
+            {
+                lEntry.mHandler->OnReceiveFrom( lEntry.mConnection, lIpAddress, lPort, &mBuffer[0], lSize );
+            }
+            else
+            {
+                lEntry.mHandler->OnReceive( lEntry.mConnection, &mBuffer[0], lSize );
+            }
+        }
+        catch( std::exception &e )
+        {
+            ReportError( lEntry, std::string( "Handler error: " ) + e.what() );
+        }
+        catch( ... )
+        {
+            ReportError( lEntry, "Handler error: unknown exception" );
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LeddarConnection::LdEthernetReactor::ReportError( const sEntry &aEntry, const std::string &aError )
+///
+/// \brief  Calls Handler::OnError. An exception thrown by OnError is dropped, it must not escape the reactor thread.
+///
+/// \param  aEntry  The entry of the socket.
+/// \param  aError  The error message.
+///
+/// \author David Levy
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void
+LeddarConnection::LdEthernetReactor::ReportError( const sEntry &aEntry, const std::string &aError )
+{
+    try
+    {
+        aEntry.mHandler->OnError( aEntry.mConnection, aError );
+    }
+    catch( ... )
+    {
+    }
+}
+
+#endif
@@ -0,0 +1,100 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \file   Leddar/LdEthernetReactor.h
+///
+/// \brief  Declares the LdEthernetReactor class
+///
+/// Copyright (c) 2018 LeddarTech. All rights reserved.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "LtDefines.h"
+#if defined(BUILD_ETHERNET) && !defined(_WIN32)
+
+#include "LdEthernet.h"
+
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace LeddarConnection
+{
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \class  LdEthernetReactor
+    ///
+    /// \brief  Serves the sockets of many LdEthernet connections from a single thread (Linux only, epoll).
+    ///
+    ///         Add registers the TCP socket (if connected) and the UDP socket (if opened with OpenUDPSocket) of a connection.
+    ///         When a socket is readable, the reactor thread drains it without blocking and gives each chunk (TCP)
+    ///         or datagram (UDP) to the handler of the connection.
+    ///         The blocking API of LdEthernet (Send, SendTo...) can still be used from other threads, but the application
+    ///         must not call Receive / ReceiveFrom on a registered connection.
+    ///
+    ///         Handler callbacks are called from the reactor thread. Remove and Stop can be called from a callback,
+    ///         deleting the reactor cannot (the destructor terminates the program).
+    ///         Once Remove returns, no callback is running or will be called for that connection.
+    ///
+    /// \author David Levy
+    /// \date   October 2026
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    class LdEthernetReactor
+    {
+    public:
+        class Handler
+        {
+        public:
+            virtual ~Handler() {}
+
+            /// \brief  Data received on the TCP socket. Chunks follow the stream, not the message boundaries.
+            virtual void OnReceive( LdEthernet *aConnection, const uint8_t *aData, size_t aSize ) = 0;
+            /// \brief  One datagram received on the UDP socket.
+            virtual void OnReceiveFrom( LdEthernet *aConnection, const std::string &aIpAddress, uint16_t aPort, const uint8_t *aData, size_t aSize ) = 0;
+            /// \brief  Socket closed by the peer or in error: the connection is removed from the reactor before the call.
+            ///         Also called with an error starting with "Handler error: " when OnReceive / OnReceiveFrom throws,
+            ///         the connection then stays registered.
+            ///         Also called with an error starting with "Reactor error: " when the reactor thread fails and stops,
+            ///         the connections stay registered and Start can be called again (not from the callback).
+            virtual void OnError( LdEthernet *aConnection, const std::string &aError ) = 0;
+        };
+
+        explicit LdEthernetReactor( size_t aBufferSize = 65536 );
+        ~LdEthernetReactor();
+
+        void    Add( LdEthernet *aConnection, Handler *aHandler );
+        void    Remove( LdEthernet *aConnection );
+        size_t  GetConnectionCount( void );
+
+        void    Start( void );
+        void    Stop( void );
+        bool    IsRunning( void ) const { return mRunning; }
+
+    private:
+        struct sEntry
+        {
+            LdEthernet *mConnection;
+            Handler    *mHandler;
+            bool        mUDP;
+        };
+
+        void Run( void );
+        void Dispatch( int aFd );
+        void RemoveLocked( LdEthernet *aConnection );
+        void ReportError( const sEntry &aEntry, const std::string &aError );
+
+        int                         mEpoll;
+        int                         mWakeUp;     ///< eventfd used by Stop to wake up epoll_wait
+        std::map<int, sEntry>       mEntries;    ///< Registered sockets, key is the file descriptor
+        std::vector<uint8_t>        mBuffer;
+        std::recursive_mutex        mMutex;      ///< Held while dispatching, recursive so callbacks can call Remove
+        std::atomic<bool>           mRunning;
+        std::thread                 mThread;
+
+        LdEthernetReactor( const LdEthernetReactor & ); //Disable copy constructor
+        LdEthernetReactor &operator=( const LdEthernetReactor & ); //Disable equal constructor
+    };
+}
+
+#endif
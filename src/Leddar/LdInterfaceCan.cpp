@@ -8,8 +8,137 @@
 #ifdef BUILD_CANBUS
 
 #include "LtStringUtils.h"
+#include "LtTimeUtils.h"
 
 #include <algorithm>
+#include <chrono>
+
+namespace
+{
+    const size_t CAN_RECEIVE_QUEUE_SIZE = 1024; ///< Frames buffered per interface by the receive thread
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn LeddarConnection::LdCanFrameQueue::LdCanFrameQueue( size_t aCapacity )
+///
+/// \brief  Constructor
+///
+/// \param  aCapacity   Maximum number of frames, rounded up to a power of 2.
+///
+/// \author David Levy
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+LeddarConnection::LdCanFrameQueue::LdCanFrameQueue( size_t aCapacity ) :
+    mMask( 0 ),
+    mHead( 0 ),
+    mTail( 0 ),
+    mDropped( 0 ),
+    mWaiting( false )
+{
+    size_t lCapacity = 1;
+
+    while( lCapacity < aCapacity )
+    {
+        lCapacity <<= 1;
+    }
+
+    mFrames.resize( lCapacity );
+    mMask = lCapacity - 1;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn bool LeddarConnection::LdCanFrameQueue::Push( const LtComCanBus::sCanData &aData, uint64_t aTimestamp )
+///
+/// \brief  Add a frame (producer only). Wakes up the consumer if it is waiting.
+///
+/// \param  aData       The frame.
+/// \param  aTimestamp  Host monotonic time of the reception, in ns.
+///
+/// \return False if the queue is full, the frame is dropped.
+///
+/// \author David Levy
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool
+LeddarConnection::LdCanFrameQueue::Push( const LtComCanBus::sCanData &aData, uint64_t aTimestamp )
+{
+    size_t lHead = mHead.load( std::memory_order_relaxed );
+
+    if( lHead - mTail.load( std::memory_order_acquire ) > mMask )
+    {
+        ++mDropped;
+        return false;
+    }
+
+    mFrames[lHead & mMask].mData = aData;
+    mFrames[lHead & mMask].mTimestamp = aTimestamp;
+    mHead.store( lHead + 1 );
+
+    //Sequentially consistent with the store of mWaiting in Wait, so either the consumer sees the frame or we see it waiting
+    if( mWaiting.load() )
+    {
+        std::lock_guard<std::mutex> lLock( mMutex );
+        mCondition.notify_one();
+    }
+
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn bool LeddarConnection::LdCanFrameQueue::Pop( LtComCanBus::sCanData &aData, uint64_t &aTimestamp )
+///
+/// \brief  Remove the oldest frame (consumer only).
+///
+/// \param [out]    aData       The frame.
+/// \param [out]    aTimestamp  Host monotonic time of the reception, in ns.
+///
+/// \return False if the queue is empty.
+///
+/// \author David Levy
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool
+LeddarConnection::LdCanFrameQueue::Pop( LtComCanBus::sCanData &aData, uint64_t &aTimestamp )
+{
+    size_t lTail = mTail.load( std::memory_order_relaxed );
+
+    if( lTail == mHead.load( std::memory_order_acquire ) )
+    {
+        return false;
+    }
+
+    aData = mFrames[lTail & mMask].mData;
+    aTimestamp = mFrames[lTail & mMask].mTimestamp;
+    mTail.store( lTail + 1, std::memory_order_release );
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn bool LeddarConnection::LdCanFrameQueue::Wait( uint32_t aTimeoutMs )
+///
+/// \brief  Wait until the queue holds a frame (consumer only).
+///
+/// \param  aTimeoutMs  The timeout in ms.
+///
+/// \return False if the timeout expired.
+///
+/// \author David Levy
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool
+LeddarConnection::LdCanFrameQueue::Wait( uint32_t aTimeoutMs )
+{
+    if( !IsEmpty() )
+    {
+        return true;
+    }
+
+    std::unique_lock<std::mutex> lLock( mMutex );
+    mWaiting = true;
+    bool lResult = mCondition.wait_for( lLock, std::chrono::milliseconds( aTimeoutMs ), [this] { return !IsEmpty(); } );
+    mWaiting = false;
+    return lResult;
+}
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// \fn LeddarConnection::LdInterfaceCan::LdInterfaceCan( const LdConnectionInfoCan *aConnectionInfo, LdConnection *aInterface )
@@ -24,7 +153,10 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 LeddarConnection::LdInterfaceCan::LdInterfaceCan( const LdConnectionInfoCan *aConnectionInfo, LdConnection *aExistingInterface ) : LdConnection( aConnectionInfo, aExistingInterface ),
     mMaster( nullptr ),
-    mIsConnected( false )
+    mIsConnected( false ),
+    mReceived( CAN_RECEIVE_QUEUE_SIZE ),
+    mReceiveTimestamp( 0 ),
+    mReceiveRunning( false )
 {
     mMaster = dynamic_cast<LdInterfaceCan *>( aExistingInterface );
 
@@ -49,6 +181,8 @@ LeddarConnection::LdInterfaceCan::LdInterfaceCan( const LdConnectionInfoCan *aCo
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 LeddarConnection::LdInterfaceCan::~LdInterfaceCan()
 {
+    StopReceiveThread();
+
     if( mMaster != nullptr )
     {
         mMaster->UnRegisterConnection( this );
@@ -93,39 +227,45 @@ void LeddarConnection::LdInterfaceCan::RegisterConnection( LeddarConnection::LdI
         throw std::logic_error( "Connection ids rx and tx (may) overlap" );
     }
 
-    //And check if it overlaps with already registered ids
-    for( size_t i = 0; i < mRegisteredIds.size(); ++i )
     {
-        if( lNewConnectionInfo->GetBaseIdRx() == mRegisteredIds[i].mConfigId )
-        {
-            throw std::logic_error( "Connection Rx id overlap: " + LeddarUtils::LtStringUtils::IntToString( lNewConnectionInfo->GetBaseIdRx(), 16 ) );
-        }
+        std::lock_guard<std::mutex> lLock( mRegisteredIdsMutex );
 
-        if( lNewConnectionInfo->GetBaseIdRx() >= mRegisteredIds[i].mFirstDataId && lNewConnectionInfo->GetBaseIdRx() <= mRegisteredIds[i].mFirstDataId + LtComCanBus::CAN_MAX_DETECTIONS + 1 )
+        //And check if it overlaps with already registered ids
+        for( size_t i = 0; i < mRegisteredIds.size(); ++i )
         {
-            throw std::logic_error( "Connection id Rx/Tx overlap: " + LeddarUtils::LtStringUtils::IntToString( lNewConnectionInfo->GetBaseIdRx(), 16 ) + "overlap " +
-                                    LeddarUtils::LtStringUtils::IntToString( mRegisteredIds[i].mFirstDataId, 16 ) + " to " +
-                                    LeddarUtils::LtStringUtils::IntToString( mRegisteredIds[i].mFirstDataId + LtComCanBus::CAN_MAX_DETECTIONS + 1, 16 ) );
-        }
+            if( lNewConnectionInfo->GetBaseIdRx() == mRegisteredIds[i].mConfigId )
+            {
+                throw std::logic_error( "Connection Rx id overlap: " + LeddarUtils::LtStringUtils::IntToString( lNewConnectionInfo->GetBaseIdRx(), 16 ) );
+            }
 
-        if( mRegisteredIds[i].mConfigId >= lNewConnectionInfo->GetBaseIdTx() && mRegisteredIds[i].mConfigId <= lNewConnectionInfo->GetBaseIdTx() + LtComCanBus::CAN_MAX_DETECTIONS + 1 )
-        {
-            throw std::logic_error( "Connection id Tx/Rx overlap: " + LeddarUtils::LtStringUtils::IntToString( mRegisteredIds[i].mConfigId, 16 ) + "overlap " +
-                                    LeddarUtils::LtStringUtils::IntToString( lNewConnectionInfo->GetBaseIdTx(), 16 ) + " to " +
-                                    LeddarUtils::LtStringUtils::IntToString( lNewConnectionInfo->GetBaseIdTx() + LtComCanBus::CAN_MAX_DETECTIONS + 1, 16 ) );
-        }
+            if( lNewConnectionInfo->GetBaseIdRx() >= mRegisteredIds[i].mFirstDataId && lNewConnectionInfo->GetBaseIdRx() <= mRegisteredIds[i].mFirstDataId + LtComCanBus::CAN_MAX_DETECTIONS + 1 )
+            {
+                throw std::logic_error( "Connection id Rx/Tx overlap: " + LeddarUtils::LtStringUtils::IntToString( lNewConnectionInfo->GetBaseIdRx(), 16 ) + "overlap " +
+                                        LeddarUtils::LtStringUtils::IntToString( mRegisteredIds[i].mFirstDataId, 16 ) + " to " +
+                                        LeddarUtils::LtStringUtils::IntToString( mRegisteredIds[i].mFirstDataId + LtComCanBus::CAN_MAX_DETECTIONS + 1, 16 ) );
+            }
 
-        if( lNewConnectionInfo->GetBaseIdTx() <= mRegisteredIds[i].mFirstDataId + LtComCanBus::CAN_MAX_DETECTIONS + 1 &&
-                mRegisteredIds[i].mFirstDataId <= lNewConnectionInfo->GetBaseIdTx() + LtComCanBus::CAN_MAX_DETECTIONS + 1 )
-        {
-            throw std::logic_error( "Connection Tx id overlap: [" + LeddarUtils::LtStringUtils::IntToString( lNewConnectionInfo->GetBaseIdTx(), 16 ) +
-                                    ";" + LeddarUtils::LtStringUtils::IntToString( lNewConnectionInfo->GetBaseIdTx() + LtComCanBus::CAN_MAX_DETECTIONS + 1, 16 ) +
-                                    "] overlap [" + LeddarUtils::LtStringUtils::IntToString( mRegisteredIds[i].mFirstDataId, 16 ) +
-                                    ";" + LeddarUtils::LtStringUtils::IntToString( mRegisteredIds[i].mFirstDataId + LtComCanBus::CAN_MAX_DETECTIONS + 1, 16 ) + "]" );
+            if( mRegisteredIds[i].mConfigId >= lNewConnectionInfo->GetBaseIdTx() && mRegisteredIds[i].mConfigId <= lNewConnectionInfo->GetBaseIdTx() + LtComCanBus::CAN_MAX_DETECTIONS + 1 )
+            {
+                throw std::logic_error( "Connection id Tx/Rx overlap: " + LeddarUtils::LtStringUtils::IntToString( mRegisteredIds[i].mConfigId, 16 ) + "overlap " +
+                                        LeddarUtils::LtStringUtils::IntToString( lNewConnectionInfo->GetBaseIdTx(), 16 ) + " to " +
+                                        LeddarUtils::LtStringUtils::IntToString( lNewConnectionInfo->GetBaseIdTx() + LtComCanBus::CAN_MAX_DETECTIONS + 1, 16 ) );
+            }
+
+            if( lNewConnectionInfo->GetBaseIdTx() <= mRegisteredIds[i].mFirstDataId + LtComCanBus::CAN_MAX_DETECTIONS + 1 &&
+                    mRegisteredIds[i].mFirstDataId <= lNewConnectionInfo->GetBaseIdTx() + LtComCanBus::CAN_MAX_DETECTIONS + 1 )
+            {
+                throw std::logic_error( "Connection Tx id overlap: [" + LeddarUtils::LtStringUtils::IntToString( lNewConnectionInfo->GetBaseIdTx(), 16 ) +
+                                        ";" + LeddarUtils::LtStringUtils::IntToString( lNewConnectionInfo->GetBaseIdTx() + LtComCanBus::CAN_MAX_DETECTIONS + 1, 16 ) +
+                                        "] overlap [" + LeddarUtils::LtStringUtils::IntToString( mRegisteredIds[i].mFirstDataId, 16 ) +
+                                        ";" + LeddarUtils::LtStringUtils::IntToString( mRegisteredIds[i].mFirstDataId + LtComCanBus::CAN_MAX_DETECTIONS + 1, 16 ) + "]" );
+            }
         }
+
+        mRegisteredIds.push_back( {aNewInterface,  lNewConnectionInfo->GetBaseIdRx(), lNewConnectionInfo->GetBaseIdTx()} );
     }
 
-    mRegisteredIds.push_back( {aNewInterface,  lNewConnectionInfo->GetBaseIdRx(), lNewConnectionInfo->GetBaseIdTx()} );
+    RegisteredIdsChanged();
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -145,14 +285,20 @@ void LeddarConnection::LdInterfaceCan::UnRegisterConnection( const LeddarConnect
         throw std::logic_error( "Only the master can unregister connection" );
     }
 
-    for( size_t i = 0; i < mRegisteredIds.size(); ++i )
     {
-        if( mRegisteredIds[i].mInterface == aInterface )
+        std::lock_guard<std::mutex> lLock( mRegisteredIdsMutex );
+
+        for( size_t i = 0; i < mRegisteredIds.size(); ++i )
         {
-            mRegisteredIds.erase( mRegisteredIds.begin() + i );
-            break;
+            if( mRegisteredIds[i].mInterface == aInterface )
+            {
+                mRegisteredIds.erase( mRegisteredIds.begin() + i );
+                break;
+            }
         }
     }
+
+    RegisteredIdsChanged();
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -179,44 +325,55 @@ void LeddarConnection::LdInterfaceCan::ChangeMaster(const std::vector<LtComCanBu
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
-/// \fn void LeddarConnection::LdInterfaceCan::ForwardDataSlave(uint16_t aId, const std::vector<uint8_t>& aData)
+/// \fn void LeddarConnection::LdInterfaceCan::ForwardDataSlave( LtComCanBus::sCanData aData, uint64_t aTimestamp )
 ///
 /// \brief  Forward data from the master to the interface with the corresponding id
 ///
-/// \param  aId     The identifier.
-/// \param  aData   The data.
+/// \param  aData       The data.
+/// \param  aTimestamp  Host monotonic time of the reception, in ns.
 ///
 /// \author David Levy
 /// \date   October 2018
 ////////////////////////////////////////////////////////////////////////////////////////////////////
-void LeddarConnection::LdInterfaceCan::ForwardDataSlave( LtComCanBus::sCanData aData )
+void LeddarConnection::LdInterfaceCan::ForwardDataSlave( LtComCanBus::sCanData aData, uint64_t aTimestamp )
 {
-    EmitSignal( LeddarCore::LdObject::NEW_DATA, &aData );
+    if( IsReceiveThreadRunning() )
+    {
+        mReceived.Push( aData, aTimestamp ); //Emitted by Read from the thread of the caller
+    }
+    else
+    {
+        mReceiveTimestamp = aTimestamp;
+        EmitSignal( LeddarCore::LdObject::NEW_DATA, &aData );
+    }
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
-/// \fn LeddarConnection::LdInterfaceCan *LeddarConnection::LdInterfaceCan::ForwardDataMaster( uint16_t aId, const std::vector<uint8_t> &aData )
+/// \fn LeddarConnection::LdInterfaceCan *LeddarConnection::LdInterfaceCan::ForwardDataMaster( uint16_t aId, const std::vector<uint8_t> &aData, uint64_t aTimestamp )
 ///
 /// \brief  Forward received data to the correct interface buffer
 ///
 /// \exception  std::logic_error    Raised when calling this function for a "slave".
 /// \exception  std::runtime_error  Raised when an unexpected id is received.
 ///
-/// \param  aId     The identifier.
-/// \param  aData   The data.
+/// \param  aId         The identifier.
+/// \param  aData       The data.
+/// \param  aTimestamp  Host monotonic time of the reception in ns, 0 for now.
 ///
 /// \return A pointer to the interface that received data.
 ///
 /// \author David Levy
 /// \date   October 2018
 ////////////////////////////////////////////////////////////////////////////////////////////////////
-LeddarConnection::LdInterfaceCan *LeddarConnection::LdInterfaceCan::ForwardDataMaster( uint16_t aId, const std::vector<uint8_t> &aData )
+LeddarConnection::LdInterfaceCan *LeddarConnection::LdInterfaceCan::ForwardDataMaster( uint16_t aId, const std::vector<uint8_t> &aData, uint64_t aTimestamp )
 {
     if( mMaster != nullptr )
     {
         throw std::logic_error( "Only the master can forward data" );
     }
 
+    std::lock_guard<std::mutex> lLock( mRegisteredIdsMutex );
+
     for( size_t i = 0; i < mRegisteredIds.size(); ++i )
     {
         if( aId >= mRegisteredIds[i].mFirstDataId && aId <=  mRegisteredIds[i].mFirstDataId + LtComCanBus::CAN_MAX_DETECTIONS + 1 )
@@ -224,7 +381,7 @@ LeddarConnection::LdInterfaceCan *LeddarConnection::LdInterfaceCan::ForwardDataM
             LtComCanBus::sCanData lData = {};
             lData.mId = aId;
             std::copy( aData.begin(), aData.end(), lData.mFrame.mRawData );
-            mRegisteredIds[i].mInterface->ForwardDataSlave( lData );
+            mRegisteredIds[i].mInterface->ForwardDataSlave( lData, aTimestamp != 0 ? aTimestamp : LeddarUtils::LtTimeUtils::GetMonotonicNanoseconds() );
             return mRegisteredIds[i].mInterface;
         }
     }
@@ -232,4 +389,195 @@ LeddarConnection::LdInterfaceCan *LeddarConnection::LdInterfaceCan::ForwardDataM
     throw std::runtime_error( "Unexpected id received: " + LeddarUtils::LtStringUtils::IntToString( aId, 16 ) );
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn bool LeddarConnection::LdInterfaceCan::Read( void )
+///
+/// \brief  Read the data of this interface.
+///         Without receive thread, reads one frame from the adapter (see Read( aRequestingInterface )).
+///         With the receive thread, emits the frames already queued for this interface, without touching the adapter.
+///
+/// \return True if this interface received data.
+///
+/// \author David Levy
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool LeddarConnection::LdInterfaceCan::Read( void )
+{
+    if( !IsReceiveThreadRunning() )
+    {
+        return Read( this );
+    }
+
+    bool lReceived = false;
+    LtComCanBus::sCanData lData;
+
+    while( mReceived.Pop( lData, mReceiveTimestamp ) )
+    {
+        EmitSignal( LeddarCore::LdObject::NEW_DATA, &lData );
+        lReceived = true;
+    }
+
+    return lReceived;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LeddarConnection::LdInterfaceCan::StartReceiveThread( void )
+///
+/// \brief  Start a thread that reads the adapter continuously and queues the frames per interface (by registered ids).
+///         The interfaces then get their data with Read() and can wait for it with WaitForData.
+///         Frames that arrive when the queue of an interface is full are dropped (see GetDroppedFrames).
+///
+/// \exception  std::logic_error    Raised when calling this function for a "slave".
+/// \exception  std::runtime_error  Raised when the interface is not connected.
+///
+/// \author David Levy
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void LeddarConnection::LdInterfaceCan::StartReceiveThread( void )
+{
+    if( mMaster != nullptr )
+    {
+        throw std::logic_error( "Only the master can start the receive thread" );
+    }
+
+    if( !mIsConnected )
+    {
+        throw std::runtime_error( "Not connected" );
+    }
+
+    if( mReceiveRunning )
+    {
+        return;
+    }
+
+    if( mReceiveThread.joinable() )
+    {
+        mReceiveThread.join();
+    }
+
+    mReceiveRunning = true;
+    mReceiveThread = std::thread( &LdInterfaceCan::ReceiveThread, this );
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LeddarConnection::LdInterfaceCan::StopReceiveThread( void )
+///
+/// \brief  Stop the receive thread and wait for it. The frames still queued can be read with Read().
+///
+/// \author David Levy
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void LeddarConnection::LdInterfaceCan::StopReceiveThread( void )
+{
+    mReceiveRunning = false;
+
+    if( mReceiveThread.joinable() )
+    {
+        mReceiveThread.join();
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn bool LeddarConnection::LdInterfaceCan::IsReceiveThreadRunning( void ) const
+///
+/// \brief  True if the master of this interface runs its receive thread.
+///
+/// \author David Levy
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool LeddarConnection::LdInterfaceCan::IsReceiveThreadRunning( void ) const
+{
+    return mMaster != nullptr ? mMaster->mReceiveRunning.load() : mReceiveRunning.load();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn bool LeddarConnection::LdInterfaceCan::WaitForData( uint32_t aTimeoutMs )
+///
+/// \brief  Wait until the receive thread queued a frame for this interface.
+///         Without receive thread, sleeps for the timeout (the caller polls with Read).
+///
+/// \param  aTimeoutMs  The timeout in ms.
+///
+/// \return True if there is data to Read.
+///
+/// \author David Levy
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool LeddarConnection::LdInterfaceCan::WaitForData( uint32_t aTimeoutMs )
+{
+    if( !IsReceiveThreadRunning() )
+    {
+        LeddarUtils::LtTimeUtils::Wait( aTimeoutMs );
+        return false;
+    }
+
+    return mReceived.Wait( aTimeoutMs );
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LeddarConnection::LdInterfaceCan::ReceiveThread( void )
+///
+/// \brief  Receive thread: drains the adapter into the queues of the interfaces.
+///
+/// \author David Levy
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void LeddarConnection::LdInterfaceCan::ReceiveThread( void )
+{
+    while( mReceiveRunning )
+    {
+        bool lRead = false;
+
+        try
+        {
+            const LdInterfaceCan *lReceiver = nullptr;
+            lRead = ReadFrame( lReceiver );
+        }
+        catch( std::exception & )
+        {
+            //Adapter event or unexpected id, the frame is lost but the next ones are still routed
+        }
+
+        if( !lRead )
+        {
+            WaitForFrame();
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LeddarConnection::LdInterfaceCan::WaitForFrame( void )
+///
+/// \brief  Called by the receive thread when the adapter has no frame. Sleeps 1 ms by default,
+///         an adapter that can block until a frame arrives should do it (with a short timeout, the thread checks for Stop).
+///
+/// \author David Levy
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void LeddarConnection::LdInterfaceCan::WaitForFrame( void )
+{
+    LeddarUtils::LtTimeUtils::Wait( 1 );
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn std::vector<std::pair<uint16_t, uint16_t> > LeddarConnection::LdInterfaceCan::GetRegisteredIdRanges( void )
+///
+/// \brief  Ids received by the registered interfaces, as [first, last] ranges. Master only.
+///
+/// \author David Levy
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+std::vector<std::pair<uint16_t, uint16_t> > LeddarConnection::LdInterfaceCan::GetRegisteredIdRanges( void )
+{
+    std::lock_guard<std::mutex> lLock( mRegisteredIdsMutex );
+    std::vector<std::pair<uint16_t, uint16_t> > lRanges;
+
+    for( size_t i = 0; i < mRegisteredIds.size(); ++i )
+    {
+        lRanges.push_back( std::make_pair( mRegisteredIds[i].mFirstDataId, static_cast<uint16_t>( mRegisteredIds[i].mFirstDataId + LtComCanBus::CAN_MAX_DETECTIONS + 1 ) ) );
+    }
+
+    return lRanges;
+}
+
 #endif
@@ -16,10 +16,55 @@
 
 #include "comm/Canbus/LtComCanbus.h"
 
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
 #include <queue>
+#include <thread>
+#include <vector>
 
 namespace LeddarConnection
 {
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \class  LdCanFrameQueue
+    ///
+    /// \brief  Bounded lock-free queue of CAN frames, one producer (the receive thread) and one consumer.
+    ///         The consumer can wait for a frame, the producer only signals when the consumer is waiting.
+    ///
+    /// \author David Levy
+    /// \date   October 2026
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    class LdCanFrameQueue
+    {
+    public:
+        explicit LdCanFrameQueue( size_t aCapacity );
+
+        bool        Push( const LtComCanBus::sCanData &aData, uint64_t aTimestamp );
+        bool        Pop( LtComCanBus::sCanData &aData, uint64_t &aTimestamp );
+        bool        IsEmpty( void ) const { return mHead.load() == mTail.load(); }
+        bool        Wait( uint32_t aTimeoutMs );
+        uint64_t    GetDroppedCount( void ) const { return mDropped; }
+
+    private:
+        struct sFrame
+        {
+            LtComCanBus::sCanData   mData;
+            uint64_t                mTimestamp;
+        };
+
+        std::vector<sFrame>     mFrames;
+        size_t                  mMask;
+        std::atomic<size_t>     mHead;      ///< Next slot written by the producer
+        std::atomic<size_t>     mTail;      ///< Next slot read by the consumer
+        std::atomic<uint64_t>   mDropped;   ///< Frames lost because the queue was full
+        std::atomic<bool>       mWaiting;   ///< The consumer is in Wait
+        std::mutex              mMutex;
+        std::condition_variable mCondition;
+
+        LdCanFrameQueue( const LdCanFrameQueue & ); //Disable copy constructor
+        LdCanFrameQueue &operator=( const LdCanFrameQueue & ); //Disable equal constructor
+    };
+
     ////////////////////////////////////////////////////////////////////////////////////////////////////
     /// \class  LdInterfaceCan.
     ///
@@ -49,26 +94,57 @@ namespace LeddarConnection
         /// \date   November 2018
         ////////////////////////////////////////////////////////////////////////////////////////////////////
         virtual bool    Read( const LdInterfaceCan *aRequestingInterface ) = 0;
-        bool            Read( void ) {return Read( this ); }
+        bool            Read( void );
         virtual void    Write( uint16_t aId, const std::vector<uint8_t> &aData ) = 0; //If master, writes to CANbus, else ask master to write
         virtual bool    WriteAndWaitForAnswer( uint16_t aId, const std::vector<uint8_t> &aData ) = 0;
         virtual bool    IsConnected( void ) const override {return mIsConnected;}
         bool            IsMaster(void) const { return mMaster == nullptr; }
 
+        void            StartReceiveThread( void );
+        void            StopReceiveThread( void );
+        bool            IsReceiveThreadRunning( void ) const;
+        bool            WaitForData( uint32_t aTimeoutMs );
+        uint64_t        GetDroppedFrames( void ) const { return mReceived.GetDroppedCount(); }
+        uint64_t        GetReceiveTimestamp( void ) const { return mReceiveTimestamp; } ///Host monotonic time (ns) of the frame being emitted with NEW_DATA
+
     protected:
         explicit LdInterfaceCan( const LdConnectionInfoCan *aConnectionInfo, LdConnection *aExistingInterface = nullptr );
-        LeddarConnection::LdInterfaceCan *ForwardDataMaster( uint16_t aId, const std::vector<uint8_t> &aData );
+        LeddarConnection::LdInterfaceCan *ForwardDataMaster( uint16_t aId, const std::vector<uint8_t> &aData, uint64_t aTimestamp = 0 );
+        std::vector<std::pair<uint16_t, uint16_t> > GetRegisteredIdRanges( void );
+        virtual void    RegisteredIdsChanged( void ) {}                         ///Called on the master when an interface is registered or unregistered
+        virtual void    WaitForFrame( void );
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \fn virtual bool LdInterfaceCan::ReadFrame( const LdInterfaceCan *&aReceiver ) = 0;
+        ///
+        /// \brief  Read one frame from the adapter without blocking and forward it with ForwardDataMaster. Master only.
+        ///
+        /// \param [out]    aReceiver   The interface the frame was forwarded to, nullptr if the frame was ignored.
+        ///
+        /// \return True if a frame was read.
+        ///
+        /// \author David Levy
+        /// \date   October 2026
+        ////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual bool    ReadFrame( const LdInterfaceCan *&aReceiver ) = 0;
 
         LdInterfaceCan  *mMaster;  ///Pointer to the "master" connection, responsible to connect / disconnect and write / read. If nullptr, it means we are the master
         bool            mIsConnected;
 
     private:
         std::vector<LtComCanBus::sCanIds> mRegisteredIds;       ///Store a pointer to a "slave" connection and his ids (and to itself).
+        std::mutex          mRegisteredIdsMutex;                ///Registration can happen while the receive thread forwards data
+        LdCanFrameQueue     mReceived;                          ///Frames of this interface received by the receive thread of the master
+        uint64_t            mReceiveTimestamp;
+        std::thread         mReceiveThread;
+        std::atomic<bool>   mReceiveRunning;
+
+        void    ReceiveThread( void );
 
         void    RegisterConnection( LeddarConnection::LdInterfaceCan *aNewInterface );
         void    UnRegisterConnection( const LeddarConnection::LdInterfaceCan *aInterface );
         void    ChangeMaster(const std::vector<LtComCanBus::sCanIds>& aRegisteredIds);
-        void    ForwardDataSlave( LtComCanBus::sCanData aData );
+        void    ForwardDataSlave( LtComCanBus::sCanData aData, uint64_t aTimestamp );
 
     };
 }
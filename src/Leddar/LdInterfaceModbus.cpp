@@ -0,0 +1,72 @@
+// *****************************************************************************
+// Module..: Leddar
+//
+/// \file    LdInterfaceModbus.cpp
+///
+/// \brief   Base class of LdInterfaceModbus
+///
+/// \author  David Levy
+///
+/// \since   October 2026
+//
+// Copyright (c) 2026 LeddarTech Inc. All rights reserved.
+// *****************************************************************************
+
+#include "LdInterfaceModbus.h"
+#ifdef BUILD_MODBUS
+
+#include "LtExceptions.h"
+
+#include "comm/Modbus/LtComModbus.h"
+#include "comm/Modbus/LtComLeddarOneModbus.h"
+#include "comm/Modbus/LtComLeddarM16Modbus.h"
+#include "comm/Modbus/LtComLeddarVu8Modbus.h"
+
+// *****************************************************************************
+// Function: LdInterfaceModbus::FetchDeviceType
+//
+/// \brief   Retrieve device type from sensor (function 0x11, report server id)
+///
+/// \author  David Levy
+///
+/// \since   November 2017
+// *****************************************************************************
+uint16_t
+LeddarConnection::LdInterfaceModbus::FetchDeviceType( void )
+{
+    uint8_t lRawRequest[2] = { mConnectionInfoModbus->GetModbusAddr(), 0x11 };
+    uint8_t lResponse[LTMODBUS_RTU_MAX_ADU_LENGTH] = { 0 };
+
+    SendRawRequest( lRawRequest, 2 );
+    size_t lReceivedSize = ReceiveRawConfirmation( lResponse, 0 );
+
+    if( lReceivedSize <= MODBUS_DATA_OFFSET )
+    {
+        Flush();
+        throw LeddarException::LtComException( "No data received." );
+    }
+    else if( lReceivedSize < MODBUS_DATA_OFFSET + lResponse[MODBUS_DATA_OFFSET] )
+    {
+        Flush();
+        return 0;
+    }
+    else if( lReceivedSize == MODBUS_DATA_OFFSET + sizeof( LtComLeddarOneModbus::sLeddarOneServerId ) + MODBUS_CRC_SIZE )
+    {
+        LtComLeddarOneModbus::sLeddarOneServerId *lDeviceInfo = reinterpret_cast<LtComLeddarOneModbus::sLeddarOneServerId *>( &lResponse[MODBUS_DATA_OFFSET] );
+        return lDeviceInfo->mDeviceId;
+    }
+    else if( lReceivedSize == MODBUS_DATA_OFFSET + sizeof( LtComLeddarM16Modbus::sLeddarM16ServerId ) + MODBUS_CRC_SIZE )
+    {
+        LtComLeddarM16Modbus::sLeddarM16ServerId *lDeviceInfo = reinterpret_cast<LtComLeddarM16Modbus::sLeddarM16ServerId *>( &lResponse[MODBUS_DATA_OFFSET] );
+        return lDeviceInfo->mDeviceId;
+    }
+    else if( lReceivedSize == MODBUS_DATA_OFFSET + sizeof( LtComLeddarVu8Modbus::sLeddarVu8ModbusServerId ) + MODBUS_CRC_SIZE )
+    {
+        LtComLeddarVu8Modbus::sLeddarVu8ModbusServerId *lDeviceInfo = reinterpret_cast<LtComLeddarVu8Modbus::sLeddarVu8ModbusServerId *>( &lResponse[MODBUS_DATA_OFFSET] );
+        return lDeviceInfo->mDeviceId;
+    }
+
+    return 0;
+}
+
+#endif
@@ -29,9 +29,12 @@ namespace LeddarConnection
         virtual void        Disconnect( void ) override = 0;
         virtual void        SendRawRequest( uint8_t *aBuffer, uint32_t aSize ) = 0;
         virtual size_t      ReceiveRawConfirmation( uint8_t *aBuffer, uint32_t aSize ) = 0;
+        virtual int         ReceiveRawConfirmationLT( uint8_t *aBuffer, int aDeviceType ) = 0;
         virtual void        ReadRegisters( uint16_t aAddr, uint8_t aNb, uint16_t *aDest ) = 0;
+        virtual void        ReadInputRegisters( uint16_t aAddr, uint8_t aNb, uint16_t *aDest ) = 0;
         virtual void        WriteRegister( uint16_t aAddr, int aValue ) = 0;
-        virtual uint16_t    FetchDeviceType( void ) = 0;
+        virtual void        Flush( void ) = 0;
+        virtual uint16_t    FetchDeviceType( void );
 
         virtual bool   IsVirtualCOMPort( void ) = 0;
 
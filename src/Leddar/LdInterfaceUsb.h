@@ -37,6 +37,10 @@ namespace LeddarConnection
         virtual void Write( uint8_t aEndPoint, uint8_t *aData, uint32_t aSize ) = 0;
         virtual void ControlTransfert( uint8_t aRequestType, uint8_t aRequest, uint8_t *aData, uint32_t aSize, uint16_t aTimeout = 1000 ) = 0;
 
+        // Asynchronous read mode: transfers are kept queued on the endpoint, Read returns the oldest completed one
+        virtual void StartAsyncRead( uint8_t aEndPoint, uint32_t aTransferSize, size_t aTransferCount ) = 0;
+        virtual void StopAsyncRead( void ) = 0;
+
     protected:
         // *****************************************************************************
         // Function: LdInterfaceUsb::LdInterfaceUsb
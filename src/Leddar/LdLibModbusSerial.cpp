@@ -41,6 +41,12 @@ extern "C" {
 #include "LtTimeUtils.h"
 #include <cerrno>
 
+namespace
+{
+    const uint32_t RTU_REQUEST_SIZE = 8;        ///< Address, function, two 16 bits fields and CRC of a read or write register request
+    const uint32_t RTU_ANSWER_OVERHEAD = 5;     ///< Address, function, byte count and CRC of a read registers answer
+}
+
 // *****************************************************************************
 // Function: LdLibModbusSerial::LdLibModbusSerial
 //
@@ -53,7 +59,9 @@ extern "C" {
 LeddarConnection::LdLibModbusSerial::LdLibModbusSerial( const LdConnectionInfoModbus *aConnectionInfo, LdConnection *aExistingConnection ) :
     LeddarConnection::LdInterfaceModbus( aConnectionInfo ),
     mHandle( nullptr ),
-    mSharedHandle( false )
+    mSharedHandle( false ),
+    mSilentIntervalUs( 0 ),
+    mBusLastFrameEnd( std::make_shared<uint64_t>( 0 ) )
 {
     LeddarConnection::LdLibModbusSerial *lExistingModbusConnection = dynamic_cast< LeddarConnection::LdLibModbusSerial * >( aExistingConnection );
 
@@ -61,6 +69,7 @@ LeddarConnection::LdLibModbusSerial::LdLibModbusSerial( const LdConnectionInfoMo
     {
         mHandle = lExistingModbusConnection->GetHandle();
         mSharedHandle = true;
+        mBusLastFrameEnd = lExistingModbusConnection->mBusLastFrameEnd; // Same bus, same silent interval
     }
 }
 
@@ -215,12 +224,18 @@ LeddarConnection::LdLibModbusSerial::SendRawRequest( uint8_t *aBuffer, uint32_t
                         errno ) ), true );
     }
 
+    WaitSilentInterval();
     int lResult = modbus_send_raw_request( mHandle, aBuffer, aSize );
+    int lErrno = errno;
+    SetFrameEnd();
+    ++mCounters->mTransactions;
 
     if( lResult < 0 )
     {
-        throw LeddarException::LtComException( "Error on modbus_send_raw_request in SendRawRequest." );
+        ThrowFailure( lErrno, "Error on modbus_send_raw_request in SendRawRequest." );
     }
+
+    mCounters->mBytesOut += lResult;
 }
 
 // *****************************************************************************
@@ -247,12 +262,19 @@ LeddarConnection::LdLibModbusSerial::ReadRegisters( uint16_t aAddr, uint8_t aNb,
                         errno ) ), true );
     }
 
+    WaitSilentInterval();
     int lStatus = modbus_read_registers( mHandle, aAddr, aNb, aDest );
+    int lErrno = errno;
+    SetFrameEnd();
+    ++mCounters->mTransactions;
+    mCounters->mBytesOut += RTU_REQUEST_SIZE;
 
     if( lStatus < 0 )
     {
-        throw LeddarException::LtComException( "Error on modbus_read_registers in ReadRegisters." );
+        ThrowFailure( lErrno, "Error on modbus_read_registers in ReadRegisters." );
     }
+
+    mCounters->mBytesIn += RTU_ANSWER_OVERHEAD + 2 * aNb;
 }
 
 // *****************************************************************************
@@ -279,12 +301,19 @@ LeddarConnection::LdLibModbusSerial::ReadInputRegisters( uint16_t aAddr, uint8_t
                         errno ) ), true );
     }
 
+    WaitSilentInterval();
     int lStatus = modbus_read_input_registers( mHandle, aAddr, aNb, aDest );
+    int lErrno = errno;
+    SetFrameEnd();
+    ++mCounters->mTransactions;
+    mCounters->mBytesOut += RTU_REQUEST_SIZE;
 
     if( lStatus < 0 )
     {
-        throw LeddarException::LtComException( "Error on modbus_read_input_registers in ReadRegistersReadInputRegisters." );
+        ThrowFailure( lErrno, "Error on modbus_read_input_registers in ReadRegistersReadInputRegisters." );
     }
+
+    mCounters->mBytesIn += RTU_ANSWER_OVERHEAD + 2 * aNb;
 }
 
 // *****************************************************************************
@@ -310,12 +339,19 @@ LeddarConnection::LdLibModbusSerial::WriteRegister( uint16_t aAddr, int aValue )
                         errno ) ), true );
     }
 
+    WaitSilentInterval();
     int lStatus = modbus_write_register( mHandle, aAddr, aValue );
+    int lErrno = errno;
+    SetFrameEnd();
+    ++mCounters->mTransactions;
+    mCounters->mBytesOut += RTU_REQUEST_SIZE;
 
     if( lStatus < 0 )
     {
-        throw LeddarException::LtComException( "Error on modbus_write_register in WriteRegisters." );
+        ThrowFailure( lErrno, "Error on modbus_write_register in WriteRegisters." );
     }
+
+    mCounters->mBytesIn += RTU_REQUEST_SIZE;
 }
 
 
@@ -358,24 +394,30 @@ LeddarConnection::LdLibModbusSerial::ReceiveRawConfirmation( uint8_t *aBuffer, u
     if( aSize )
     {
         lResult = modbus_receive_raw_confirmation_sizeEnd( mHandle, aBuffer, aSize );
+        int lErrno = errno;
+        SetFrameEnd();
 
         if( lResult < 0 )
         {
             modbus_flush( mHandle );
-            throw LeddarException::LtComException( "Error on modbus modbus_receive_raw_confirmation_sizeEnd in ReceiveRawConfirmation (" + LeddarUtils::LtStringUtils::IntToString( lResult ) + ")." );
+            ThrowFailure( lErrno, "Error on modbus modbus_receive_raw_confirmation_sizeEnd in ReceiveRawConfirmation (" + LeddarUtils::LtStringUtils::IntToString( lResult ) + ")." );
         }
     }
     else
     {
         lResult = modbus_receive_raw_confirmation_timeoutEnd( mHandle, aBuffer );
+        int lErrno = errno;
+        SetFrameEnd();
 
         if( lResult < 0 )
         {
             modbus_flush( mHandle );
-            throw LeddarException::LtComException( "Error on modbus modbus_receive_raw_confirmation_timeoutEnd in ReceiveRawConfirmation (" + LeddarUtils::LtStringUtils::IntToString( lResult ) + ")." );
+            ThrowFailure( lErrno, "Error on modbus modbus_receive_raw_confirmation_timeoutEnd in ReceiveRawConfirmation (" + LeddarUtils::LtStringUtils::IntToString( lResult ) + ")." );
         }
     }
 
+    mCounters->mBytesIn += lResult;
+
     // Check if the received message has an error
     if( ( aBuffer[ 1 ] >> 7 ) == 1 )
     {
@@ -428,12 +470,17 @@ LeddarConnection::LdLibModbusSerial::ReceiveRawConfirmationLT( uint8_t *aBuffer,
         throw std::runtime_error( "LT custom command not supported for this sensor." );
     }
 
+    int lErrno = errno;
+    SetFrameEnd();
+
     if( lResult < 0 )
     {
         modbus_flush( mHandle );
-        throw LeddarException::LtComException( "Error on modbus modbus_receive_raw_confirmation_timeoutEnd in ReceiveRawConfirmation (" + LeddarUtils::LtStringUtils::IntToString( lResult ) + ")." );
+        ThrowFailure( lErrno, "Error on modbus modbus_receive_raw_confirmation_timeoutEnd in ReceiveRawConfirmation (" + LeddarUtils::LtStringUtils::IntToString( lResult ) + ")." );
     }
 
+    mCounters->mBytesIn += lResult;
+
     // Check if the received message has an error
     if( ( aBuffer[ 1 ] >> 7 ) == 1 )
     {
@@ -505,51 +552,112 @@ LeddarConnection::LdLibModbusSerial::Flush( void )
 
 
 // *****************************************************************************
-// Function: LdLibModbusSerial::FetchDeviceType
+// Function: LdLibModbusSerial::GetSilentInterval
 //
-/// \brief   Retrieve device type from sensor
+/// \brief   Silent interval required between two RTU frames: the value set by
+///          SetSilentInterval, or 3.5 character times at the configured baud rate.
+///
+/// \return  Silent interval in microseconds.
 ///
 /// \author  David Levy
 ///
-/// \since   November 2017
+/// \since   October 2026
 // *****************************************************************************
-uint16_t
-LeddarConnection::LdLibModbusSerial::FetchDeviceType( void )
+uint32_t
+LeddarConnection::LdLibModbusSerial::GetSilentInterval( void ) const
 {
-    uint8_t lRawRequest[2] = { mConnectionInfoModbus->GetModbusAddr(), 0x11 };
-    uint8_t lResponse[MODBUS_RTU_MAX_ADU_LENGTH] = { 0 };
+    if( mSilentIntervalUs != 0 )
+    {
+        return mSilentIntervalUs;
+    }
 
-    SendRawRequest( lRawRequest, 2 );
-    size_t lReceivedSize = ReceiveRawConfirmation( lResponse, 0 );
-    LeddarUtils::LtTimeUtils::WaitBlockingMicro( ONE_WAIT_AFTER_REQUEST );
+    uint32_t lBaud = mConnectionInfoModbus->GetBaud();
 
-    if( lReceivedSize <= MODBUS_DATA_OFFSET )
+    if( lBaud == 0 )
     {
-        Flush();
-        throw LeddarException::LtComException( "No data received." );
+        return ONE_WAIT_AFTER_REQUEST;
     }
-    else if( lReceivedSize < MODBUS_DATA_OFFSET + lResponse[MODBUS_DATA_OFFSET] )
+
+    // Start bit + data bits + parity bit + stop bits
+    uint32_t lBitsPerChar = 1 + mConnectionInfoModbus->GetDataBits() + mConnectionInfoModbus->GetStopBits() +
+                            ( mConnectionInfoModbus->GetParity() != LdConnectionInfoModbus::MB_PARITY_NONE ? 1 : 0 );
+
+    // 3.5 characters, rounded up
+    return static_cast<uint32_t>( ( static_cast<uint64_t>( lBitsPerChar ) * 3500000 + lBaud - 1 ) / lBaud );
+}
+
+// *****************************************************************************
+// Function: LdLibModbusSerial::WaitSilentInterval
+//
+/// \brief   Wait until the silent interval since the end of the last frame on
+///          the bus is over. Does not wait if the time already went by.
+///
+/// \author  David Levy
+///
+/// \since   October 2026
+// *****************************************************************************
+void
+LeddarConnection::LdLibModbusSerial::WaitSilentInterval( void )
+{
+    if( *mBusLastFrameEnd == 0 )
     {
-        Flush();
-        return 0;
+        return;
     }
-    else if( lReceivedSize == MODBUS_DATA_OFFSET + sizeof( LtComLeddarOneModbus::sLeddarOneServerId ) + MODBUS_CRC_SIZE )
+
+    uint64_t lElapsedUs = ( LeddarUtils::LtTimeUtils::GetMonotonicNanoseconds() - *mBusLastFrameEnd ) / 1000;
+    uint32_t lSilentInterval = GetSilentInterval();
+
+    if( lElapsedUs < lSilentInterval )
     {
-        LtComLeddarOneModbus::sLeddarOneServerId *lDeviceInfo = reinterpret_cast<LtComLeddarOneModbus::sLeddarOneServerId *>( &lResponse[MODBUS_DATA_OFFSET] );
-        return lDeviceInfo->mDeviceId;
+        LeddarUtils::LtTimeUtils::WaitBlockingMicro( static_cast<uint32_t>( lSilentInterval - lElapsedUs ) );
     }
-    else if( lReceivedSize == MODBUS_DATA_OFFSET + sizeof( LtComLeddarM16Modbus::sLeddarM16ServerId ) + MODBUS_CRC_SIZE )
+}
+
+// *****************************************************************************
+// Function: LdLibModbusSerial::SetFrameEnd
+//
+/// \brief   Record the end of a frame on the bus (request sent or answer
+///          received), start of the next silent interval.
+///
+/// \author  David Levy
+///
+/// \since   October 2026
+// *****************************************************************************
+void
+LeddarConnection::LdLibModbusSerial::SetFrameEnd( void )
+{
+    *mBusLastFrameEnd = LeddarUtils::LtTimeUtils::GetMonotonicNanoseconds();
+}
+
+// *****************************************************************************
+// Function: LdLibModbusSerial::ThrowFailure
+//
+/// \brief   Count a failed libmodbus call in the transport counters and throw the matching exception.
+///
+/// \param   aErrno      errno set by libmodbus, ETIMEDOUT for a timeout and EMBBADCRC for a CRC failure.
+/// \param   aMessage    Message of the exception.
+///
+/// \exception LtTimeoutException on a timeout, LtCrcException on a CRC failure, LtComException otherwise.
+///
+/// \author  David Levy
+///
+/// \since   October 2026
+// *****************************************************************************
+void
+LeddarConnection::LdLibModbusSerial::ThrowFailure( int aErrno, const std::string &aMessage )
+{
+    if( aErrno == ETIMEDOUT )
     {
-        LtComLeddarM16Modbus::sLeddarM16ServerId *lDeviceInfo = reinterpret_cast<LtComLeddarM16Modbus::sLeddarM16ServerId *>( &lResponse[MODBUS_DATA_OFFSET] );
-        return lDeviceInfo->mDeviceId;
+        ++mCounters->mTimeouts;
+        throw LeddarException::LtTimeoutException( aMessage );
     }
-    else if( lReceivedSize == MODBUS_DATA_OFFSET + sizeof( LtComLeddarVu8Modbus::sLeddarVu8ModbusServerId ) + MODBUS_CRC_SIZE )
+    else if( aErrno == EMBBADCRC )
     {
-        LtComLeddarVu8Modbus::sLeddarVu8ModbusServerId *lDeviceInfo = reinterpret_cast<LtComLeddarVu8Modbus::sLeddarVu8ModbusServerId *>( &lResponse[MODBUS_DATA_OFFSET] );
-        return lDeviceInfo->mDeviceId;
+        ++mCounters->mCrcFailures;
+        throw LeddarException::LtCrcException( aMessage );
     }
 
-    return 0;
+    throw LeddarException::LtComException( aMessage );
 }
 
-#endif
\ No newline at end of file
+#endif
@@ -20,6 +20,7 @@
 #include "LdInterfaceModbus.h"
 #include "LdConnectionInfoModbus.h"
 
+#include <memory>
 #include <vector>
 
 struct _modbus;
@@ -37,21 +38,30 @@ namespace LeddarConnection
         virtual void        Disconnect( void ) override;
         virtual void        SendRawRequest( uint8_t *aBuffer, uint32_t aSize ) override;
         virtual void        ReadRegisters( uint16_t aAddr, uint8_t aNb, uint16_t *aDest ) override;
-        virtual void        ReadInputRegisters( uint16_t aAddr, uint8_t aNb, uint16_t *aDest );
+        virtual void        ReadInputRegisters( uint16_t aAddr, uint8_t aNb, uint16_t *aDest ) override;
         virtual void        WriteRegister( uint16_t aAddr, int aValue ) override;
         virtual size_t      ReceiveRawConfirmation( uint8_t *aBuffer, uint32_t aSize ) override;
-        int                 ReceiveRawConfirmationLT( uint8_t *aBuffer, int aDeviceType );
-        virtual void        Flush( void );
+        virtual int         ReceiveRawConfirmationLT( uint8_t *aBuffer, int aDeviceType ) override;
+        virtual void        Flush( void ) override;
         virtual modbus_t    *GetHandle( void ) { return mHandle; }
-        virtual uint16_t    FetchDeviceType( void ) override;
+        virtual const void  *GetTransportKey( void ) const override { return mBusLastFrameEnd.get(); } //Same for all the connections sharing the handle, and stable across reconnections
 
         virtual bool        IsVirtualCOMPort( void ) override;
 
         static std::vector<LdConnectionInfo *> GetDeviceList( void );
 
+        uint32_t            GetSilentInterval( void ) const;
+        void                SetSilentInterval( uint32_t aMicroseconds ) { mSilentIntervalUs = aMicroseconds; }
+
     protected:
+        void                WaitSilentInterval( void );
+        void                SetFrameEnd( void );
+        void                ThrowFailure( int aErrno, const std::string &aMessage );
+
         modbus_t                *mHandle;
         bool                    mSharedHandle;
+        uint32_t                mSilentIntervalUs;  ///< Forced silent interval in us, 0 to compute it from the baud rate
+        std::shared_ptr<uint64_t> mBusLastFrameEnd; ///< Monotonic time (ns) of the end of the last frame on the bus, shared by the connections on the handle
 
     };
 }
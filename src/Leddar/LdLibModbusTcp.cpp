@@ -0,0 +1,927 @@
+// *****************************************************************************
+// Module..: Leddar
+//
+/// \file    LdLibModbusTcp.cpp
+///
+/// \brief   Class definition of LdLibModbusTcp
+///
+/// \author  David Levy
+///
+/// \since   October 2026
+//
+// Copyright (c) 2026 LeddarTech Inc. All rights reserved.
+// *****************************************************************************
+
+#include "LdLibModbusTcp.h"
+#ifdef BUILD_MODBUS
+
+#include "LtCRCUtils.h"
+#include "LtExceptions.h"
+#include "LtStringUtils.h"
+
+#include "comm/Modbus/LtComModbus.h"
+#include "comm/LtComLeddarTechPublic.h"
+
+#ifdef _WIN32
+#include <winsock2.h>
+#define LAST_ERROR WSAGetLastError()
+#define WOULD_BLOCK( aError ) ( ( aError ) == WSAEWOULDBLOCK )
+#else
+#include <sys/select.h>
+#include <sys/socket.h>
+#define LAST_ERROR errno
+#define WOULD_BLOCK( aError ) ( ( aError ) == EAGAIN || ( aError ) == EWOULDBLOCK || ( aError ) == EINTR )
+#endif
+
+extern "C" {
+#ifdef __GNUC__
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpedantic"
+#endif
+#include "modbus.h"
+#ifdef __GNUC__
+#pragma GCC diagnostic pop
+#endif
+}
+
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <map>
+#include <mutex>
+#include <set>
+
+namespace
+{
+    const uint32_t MBAP_HEADER_SIZE = 6;        ///< Transaction id, protocol id and length. The unit id is counted in the length
+    const uint32_t MBAP_MAX_LENGTH = LTMODBUS_RTU_MAX_ADU_LENGTH - MODBUS_CRC_SIZE; ///< Unit id + PDU, same PDU limit as RTU
+
+    uint16_t ReadBigEndian16( const uint8_t *aData )
+    {
+        return static_cast<uint16_t>( ( aData[0] << 8 ) | aData[1] );
+    }
+}
+
+namespace LeddarConnection
+{
+    // *****************************************************************************
+    // Class: LdModbusTcpChannel
+    //
+    /// \brief   Socket to a Modbus TCP device or gateway, shared by the connections
+    ///          to the unit ids behind it.
+    ///
+    ///          The requests are sent with a new transaction id. The thread waiting
+    ///          for an answer reads the socket for everybody (one at a time) and
+    ///          files each answer under its transaction id, so an answer to another
+    ///          request wakes the thread waiting for it.
+    ///
+    ///          The socket is closed when the last connection sharing the channel
+    ///          releases it. Open and Close wait for the Send and the socket read
+    ///          in progress, so no thread uses a closed (or reused) descriptor.
+    ///
+    /// \author  David Levy
+    ///
+    /// \since   October 2026
+    // *****************************************************************************
+    class LdModbusTcpChannel
+    {
+    public:
+        LdModbusTcpChannel() : mHandle( nullptr ), mSocket( -1 ), mNextTransaction( 0 ), mReading( false ), mBroken( false ) {}
+        ~LdModbusTcpChannel() { Close(); }
+
+        void                    Open( const LdConnectionInfoModbusTcp *aConnectionInfo );
+        void                    Close( void );
+        bool                    IsOpen( void ) const;
+        uint16_t                Send( const uint8_t *aAdu, uint32_t aSize );
+        std::vector<uint8_t>    Receive( uint16_t aTransaction, uint32_t aTimeoutMs );
+        void                    Abandon( uint16_t aTransaction );
+
+    private:
+        typedef std::vector<std::pair<uint16_t, std::vector<uint8_t> > > tAnswers;
+
+        tAnswers                ReadSocket( uint32_t aTimeoutMs );
+        void                    CloseLocked( std::unique_lock<std::mutex> &aLock );
+
+        modbus_t                *mHandle;           ///< Changed with mSendMutex and mMutex held, and no read in progress
+        int                     mSocket;
+        std::mutex              mSendMutex;
+        uint16_t                mNextTransaction;   ///< Protected by mSendMutex
+        mutable std::mutex      mMutex;
+        std::condition_variable mCondition;
+        bool                    mReading;           ///< A thread is reading the socket
+        std::atomic<bool>       mBroken;            ///< The socket failed, answers will not come
+        std::map<uint16_t, std::vector<uint8_t> > mAnswers; ///< Answers (unit id + PDU) not yet claimed, by transaction id
+        std::set<uint16_t>      mAbandoned;         ///< Transactions nobody waits for anymore
+        std::vector<uint8_t>    mRxBuffer;          ///< Bytes of incomplete frames, used by the reading thread only
+
+        LdModbusTcpChannel( const LdModbusTcpChannel & ); //Disable copy constructor
+        LdModbusTcpChannel &operator=( const LdModbusTcpChannel & ); //Disable equal constructor
+    };
+}
+
+// *****************************************************************************
+// Function: LdModbusTcpChannel::Open
+//
+/// \brief   Connect to the device or the gateway. libmodbus resolves the host
+///          and connects (with TCP_NODELAY), the framing is done here.
+///
+/// \param   aConnectionInfo Host, port and timeout.
+///
+/// \exception LtConnectionFailed If the connection failed.
+///
+/// \author  David Levy
+///
+/// \since   October 2026
+// *****************************************************************************
+void
+LeddarConnection::LdModbusTcpChannel::Open( const LdConnectionInfoModbusTcp *aConnectionInfo )
+{
+    std::lock_guard<std::mutex> lSendLock( mSendMutex );
+    std::unique_lock<std::mutex> lLock( mMutex );
+    CloseLocked( lLock );
+
+    mHandle = modbus_new_tcp_pi( aConnectionInfo->GetHost().c_str(), LeddarUtils::LtStringUtils::IntToString( aConnectionInfo->GetPort() ).c_str() );
+
+    if( mHandle == nullptr )
+    {
+        throw LeddarException::LtConnectionFailed( "Wrong argument on modbus TCP device creation, Host: " + aConnectionInfo->GetHost()
+                + " Port: " + LeddarUtils::LtStringUtils::IntToString( aConnectionInfo->GetPort() ), true );
+    }
+
+    // Used by libmodbus as the connection timeout
+    modbus_set_response_timeout( mHandle, aConnectionInfo->GetTimeout() / 1000, ( aConnectionInfo->GetTimeout() % 1000 ) * 1000 );
+
+    if( modbus_connect( mHandle ) != 0 )
+    {
+        int lErrno = errno;
+        modbus_free( mHandle );
+        mHandle = nullptr;
+
+        throw LeddarException::LtConnectionFailed( "Connection failed, libmodbus errno: (" + LeddarUtils::LtStringUtils::IntToString( lErrno ) + std::string( "),  msg: " ) + std::string(
+                    modbus_strerror( lErrno ) ), true );
+    }
+
+    mSocket = modbus_get_socket( mHandle );
+    mBroken = false;
+    mRxBuffer.clear();
+}
+
+// *****************************************************************************
+// Function: LdModbusTcpChannel::Close
+//
+/// \brief   Close the socket and drop the answers not claimed. Waits for the
+///          Send and the socket read in progress, the threads waiting for an
+///          answer then get an exception.
+///
+/// \author  David Levy
+///
+/// \since   October 2026
+// *****************************************************************************
+void
+LeddarConnection::LdModbusTcpChannel::Close( void )
+{
+    std::lock_guard<std::mutex> lSendLock( mSendMutex );
+    std::unique_lock<std::mutex> lLock( mMutex );
+    CloseLocked( lLock );
+}
+
+// *****************************************************************************
+// Function: LdModbusTcpChannel::CloseLocked
+//
+/// \brief   Close, mSendMutex and mMutex (aLock) must be held.
+///
+/// \param   aLock   The lock of mMutex, released while waiting for the reading thread.
+///
+/// \author  David Levy
+///
+/// \since   October 2026
+// *****************************************************************************
+void
+LeddarConnection::LdModbusTcpChannel::CloseLocked( std::unique_lock<std::mutex> &aLock )
+{
+    // The reading thread uses mSocket without mMutex, its select is bounded by the timeout of its request
+    while( mReading )
+    {
+        mCondition.wait( aLock );
+    }
+
+    if( mHandle != nullptr )
+    {
+        modbus_close( mHandle );
+        modbus_free( mHandle );
+        mHandle = nullptr;
+        mSocket = -1;
+    }
+
+    mAnswers.clear();
+    mAbandoned.clear();
+    mCondition.notify_all();
+}
+
+// *****************************************************************************
+// Function: LdModbusTcpChannel::IsOpen
+//
+/// \brief   Return true if the socket is open and did not fail.
+///
+/// \author  David Levy
+///
+/// \since   October 2026
+// *****************************************************************************
+bool
+LeddarConnection::LdModbusTcpChannel::IsOpen( void ) const
+{
+    std::lock_guard<std::mutex> lLock( mMutex );
+    return mHandle != nullptr && !mBroken;
+}
+
+// *****************************************************************************
+// Function: LdModbusTcpChannel::Send
+//
+/// \brief   Send a request with a new transaction id.
+///
+/// \param   aAdu   Unit id followed by the PDU.
+/// \param   aSize  Size of aAdu.
+///
+/// \return  The transaction id of the request.
+///
+/// \exception LtComException on error in sending request
+///
+/// \author  David Levy
+///
+/// \since   October 2026
+// *****************************************************************************
+uint16_t
+LeddarConnection::LdModbusTcpChannel::Send( const uint8_t *aAdu, uint32_t aSize )
+{
+    std::lock_guard<std::mutex> lSendLock( mSendMutex );
+
+    if( mHandle == nullptr )
+    {
+        throw LeddarException::LtComException( "Modbus TCP connection closed.", LeddarException::ERROR_COM_UNKNOWN, true );
+    }
+
+    uint16_t lTransaction = mNextTransaction++;
+
+    {
+        // The id wrapped around, forget the previous request with this id
+        std::lock_guard<std::mutex> lLock( mMutex );
+        mAnswers.erase( lTransaction );
+        mAbandoned.erase( lTransaction );
+    }
+
+    std::vector<uint8_t> lFrame( MBAP_HEADER_SIZE + aSize );
+    lFrame[0] = static_cast<uint8_t>( lTransaction >> 8 );
+    lFrame[1] = static_cast<uint8_t>( lTransaction & 0xFF );
+    lFrame[2] = 0; // Protocol id: Modbus
+    lFrame[3] = 0;
+    lFrame[4] = static_cast<uint8_t>( aSize >> 8 );
+    lFrame[5] = static_cast<uint8_t>( aSize & 0xFF );
+    memcpy( &lFrame[MBAP_HEADER_SIZE], aAdu, aSize );
+
+    size_t lSent = 0;
+
+    while( lSent < lFrame.size() )
+    {
+#ifdef MSG_NOSIGNAL
+        int lFlags = MSG_NOSIGNAL;
+#else
+        int lFlags = 0;
+#endif
+        int lResult = static_cast<int>( send( mSocket, reinterpret_cast<const char *>( &lFrame[lSent] ), static_cast<int>( lFrame.size() - lSent ), lFlags ) );
+
+        if( lResult > 0 )
+        {
+            lSent += lResult;
+            continue;
+        }
+
+        int lError = LAST_ERROR;
+
+        if( lResult < 0 && WOULD_BLOCK( lError ) ) // The socket is non blocking, wait until it can send
+        {
+            fd_set lWriteSet;
+            FD_ZERO( &lWriteSet );
+            FD_SET( mSocket, &lWriteSet );
+            struct timeval lTimeout = { 1, 0 };
+
+            if( select( mSocket + 1, nullptr, &lWriteSet, nullptr, &lTimeout ) > 0 )
+            {
+                continue;
+            }
+        }
+
+        mBroken = true;
+        throw LeddarException::LtComException( "Error on send in modbus TCP SendRawRequest (" + LeddarUtils::LtStringUtils::IntToString( lError ) + ").", LeddarException::ERROR_COM_UNKNOWN, true );
+    }
+
+    return lTransaction;
+}
+
+// *****************************************************************************
+// Function: LdModbusTcpChannel::ReadSocket
+//
+/// \brief   Read what the socket has (waiting up to aTimeoutMs) and extract the
+///          complete frames. Called by one thread at a time, without mMutex.
+///
+/// \param   aTimeoutMs Maximum wait for data.
+///
+/// \return  The complete frames received: transaction id, unit id + PDU.
+///
+/// \exception LtComException on socket error or invalid frame.
+///
+/// \author  David Levy
+///
+/// \since   October 2026
+// *****************************************************************************
+LeddarConnection::LdModbusTcpChannel::tAnswers
+LeddarConnection::LdModbusTcpChannel::ReadSocket( uint32_t aTimeoutMs )
+{
+    tAnswers lAnswers;
+
+    fd_set lReadSet;
+    FD_ZERO( &lReadSet );
+    FD_SET( mSocket, &lReadSet );
+    struct timeval lTimeout;
+    lTimeout.tv_sec = aTimeoutMs / 1000;
+    lTimeout.tv_usec = ( aTimeoutMs % 1000 ) * 1000;
+
+    int lSelect = select( mSocket + 1, &lReadSet, nullptr, nullptr, &lTimeout );
+
+    if( lSelect == 0 )
+    {
+        return lAnswers;
+    }
+
+    uint8_t lBuffer[1024];
+    int lResult = ( lSelect > 0 ? static_cast<int>( recv( mSocket, reinterpret_cast<char *>( lBuffer ), sizeof( lBuffer ), 0 ) ) : -1 );
+
+    if( lResult == 0 )
+    {
+        throw LeddarException::LtComException( "Modbus TCP connection closed by the remote host.", LeddarException::ERROR_COM_UNKNOWN, true );
+    }
+    else if( lResult < 0 )
+    {
+        int lError = LAST_ERROR;
+
+        if( WOULD_BLOCK( lError ) )
+        {
+            return lAnswers;
+        }
+
+        throw LeddarException::LtComException( "Error on recv in modbus TCP ReceiveRawConfirmation (" + LeddarUtils::LtStringUtils::IntToString( lError ) + ").", LeddarException::ERROR_COM_UNKNOWN, true );
+    }
+
+    mRxBuffer.insert( mRxBuffer.end(), lBuffer, lBuffer + lResult );
+
+    size_t lOffset = 0;
+
+    while( mRxBuffer.size() - lOffset >= MBAP_HEADER_SIZE )
+    {
+        const uint8_t *lHeader = &mRxBuffer[lOffset];
+        uint16_t lLength = ReadBigEndian16( lHeader + 4 );
+
+        if( ReadBigEndian16( lHeader + 2 ) != 0 || lLength < 2 || lLength > MBAP_MAX_LENGTH )
+        {
+            // Lost the framing, nothing after this can be trusted
+            throw LeddarException::LtComException( "Invalid modbus TCP header received.", LeddarException::ERROR_COM_UNKNOWN, true );
+        }
+
+        if( mRxBuffer.size() - lOffset < MBAP_HEADER_SIZE + lLength )
+        {
+            break;
+        }
+
+        lAnswers.push_back( std::make_pair( ReadBigEndian16( lHeader ), std::vector<uint8_t>( lHeader + MBAP_HEADER_SIZE, lHeader + MBAP_HEADER_SIZE + lLength ) ) );
+        lOffset += MBAP_HEADER_SIZE + lLength;
+    }
+
+    mRxBuffer.erase( mRxBuffer.begin(), mRxBuffer.begin() + lOffset );
+    return lAnswers;
+}
+
+// *****************************************************************************
+// Function: LdModbusTcpChannel::Receive
+//
+/// \brief   Wait for the answer of a transaction. Reads the socket if no other
+///          thread does, else waits to be woken by it.
+///
+/// \param   aTransaction   Transaction id returned by Send.
+/// \param   aTimeoutMs     Answer timeout.
+///
+/// \return  Unit id followed by the PDU of the answer.
+///
+/// \exception LtTimeoutException if the answer did not come in time.
+/// \exception LtComException on socket error.
+///
+/// \author  David Levy
+///
+/// \since   October 2026
+// *****************************************************************************
+std::vector<uint8_t>
+LeddarConnection::LdModbusTcpChannel::Receive( uint16_t aTransaction, uint32_t aTimeoutMs )
+{
+    const std::chrono::steady_clock::time_point lDeadline = std::chrono::steady_clock::now() + std::chrono::milliseconds( aTimeoutMs );
+    std::unique_lock<std::mutex> lLock( mMutex );
+
+    while( true )
+    {
+        std::map<uint16_t, std::vector<uint8_t> >::iterator lAnswer = mAnswers.find( aTransaction );
+
+        if( lAnswer != mAnswers.end() )
+        {
+            std::vector<uint8_t> lResult;
+            lResult.swap( lAnswer->second );
+            mAnswers.erase( lAnswer );
+            return lResult;
+        }
+
+        if( mBroken || mHandle == nullptr )
+        {
+            throw LeddarException::LtComException( "Modbus TCP connection lost.", LeddarException::ERROR_COM_UNKNOWN, true );
+        }
+
+        std::chrono::steady_clock::time_point lNow = std::chrono::steady_clock::now();
+
+        if( lNow >= lDeadline )
+        {
+            mAbandoned.insert( aTransaction );
+            throw LeddarException::LtTimeoutException( "No answer to modbus TCP transaction " + LeddarUtils::LtStringUtils::IntToString( aTransaction ) + "." );
+        }
+
+        if( mReading )
+        {
+            mCondition.wait_until( lLock, lDeadline );
+            continue;
+        }
+
+        mReading = true;
+        lLock.unlock();
+        tAnswers lAnswers;
+
+        try
+        {
+            lAnswers = ReadSocket( static_cast<uint32_t>( std::chrono::duration_cast<std::chrono::milliseconds>( lDeadline - lNow ).count() ) + 1 );
+        }
+        catch( ... )
+        {
+            lLock.lock();
+            mReading = false;
+            mBroken = true;
+            mCondition.notify_all();
+            throw;
+        }
+
+        lLock.lock();
+        mReading = false;
+
+        for( size_t i = 0; i < lAnswers.size(); ++i )
+        {
+            if( mAbandoned.erase( lAnswers[i].first ) == 0 )
+            {
+                mAnswers[lAnswers[i].first].swap( lAnswers[i].second );
+            }
+        }
+
+        mCondition.notify_all();
+    }
+}
+
+// *****************************************************************************
+// Function: LdModbusTcpChannel::Abandon
+//
+/// \brief   Nobody will wait for the answer of this transaction: drop it, now or
+///          when it arrives.
+///
+/// \param   aTransaction   Transaction id returned by Send.
+///
+/// \author  David Levy
+///
+/// \since   October 2026
+// *****************************************************************************
+void
+LeddarConnection::LdModbusTcpChannel::Abandon( uint16_t aTransaction )
+{
+    std::lock_guard<std::mutex> lLock( mMutex );
+
+    if( mAnswers.erase( aTransaction ) == 0 )
+    {
+        mAbandoned.insert( aTransaction );
+    }
+}
+
+// *****************************************************************************
+// Function: LdLibModbusTcp::LdLibModbusTcp
+//
+/// \brief   Constructor.
+///
+/// \param   aConnectionInfo        Host, port, unit id and timeout.
+/// \param   aExistingConnection    If non-null, a LdLibModbusTcp to the same gateway, its socket is shared.
+///
+/// \author  David Levy
+///
+/// \since   October 2026
+// *****************************************************************************
+LeddarConnection::LdLibModbusTcp::LdLibModbusTcp( const LdConnectionInfoModbusTcp *aConnectionInfo, LdConnection *aExistingConnection ) :
+    LeddarConnection::LdInterfaceModbus( aConnectionInfo ),
+    mConnectionInfoTcp( aConnectionInfo ),
+    mPending( -1 )
+{
+    LeddarConnection::LdLibModbusTcp *lExistingModbusConnection = dynamic_cast< LeddarConnection::LdLibModbusTcp * >( aExistingConnection );
+
+    if( lExistingModbusConnection != nullptr )
+    {
+        mChannel = lExistingModbusConnection->mChannel;
+    }
+    else
+    {
+        mChannel = std::make_shared<LdModbusTcpChannel>();
+    }
+}
+
+// *****************************************************************************
+// Function: LdLibModbusTcp::~LdLibModbusTcp
+//
+/// \brief   Destructor. The socket is closed with the last connection sharing it.
+///
+/// \author  David Levy
+///
+/// \since   October 2026
+// *****************************************************************************
+LeddarConnection::LdLibModbusTcp::~LdLibModbusTcp()
+{
+    LdLibModbusTcp::Disconnect();
+}
+
+// *****************************************************************************
+// Function: LdLibModbusTcp::Connect
+//
+/// \brief   Connect to the gateway (if the socket is not already open) and read
+///          the device type of the unit id.
+///
+/// \exception LtConnectionFailed If the connection failed.
+///
+/// \author  David Levy
+///
+/// \since   October 2026
+// *****************************************************************************
+void
+LeddarConnection::LdLibModbusTcp::Connect( void )
+{
+    try
+    {
+        if( !mChannel->IsOpen() )
+        {
+            mChannel->Open( mConnectionInfoTcp );
+        }
+
+        SetDeviceType( FetchDeviceType() );
+    }
+    catch( std::exception & /*e*/ )
+    {
+        Disconnect();
+        throw;
+    }
+}
+
+// *****************************************************************************
+// Function: LdLibModbusTcp::IsConnected
+//
+/// \brief   Return true if the socket is open.
+///
+/// \author  David Levy
+///
+/// \since   October 2026
+// *****************************************************************************
+bool
+LeddarConnection::LdLibModbusTcp::IsConnected( void ) const
+{
+    return mChannel->IsOpen();
+}
+
+// *****************************************************************************
+// Function: LdLibModbusTcp::Disconnect
+//
+/// \brief   Disconnect the device. The socket stays open for the other
+///          connections sharing it, it is closed now only if there is none.
+///
+/// \author  David Levy
+///
+/// \since   October 2026
+// *****************************************************************************
+void
+LeddarConnection::LdLibModbusTcp::Disconnect( void )
+{
+    Flush();
+
+    // The channel is only copied when a connection is created, a count of 1 cannot grow behind our back
+    if( mChannel.use_count() == 1 )
+    {
+        mChannel->Close();
+    }
+}
+
+// *****************************************************************************
+// Function: LdLibModbusTcp::SendRawRequest
+//
+/// \brief   Send raw request on modbus interface. The answer must be read with
+///          ReceiveRawConfirmation, other connections can send their requests in
+///          the meantime.
+///
+/// \param   aBuffer Buffer to send: modbus address, function code and data.
+/// \param   aSize Data length to send: this not include the length of Modbus CRC field.
+///
+/// \exception LtComException on error in sending request
+///
+/// \author  David Levy
+///
+/// \since   October 2026
+// *****************************************************************************
+void
+LeddarConnection::LdLibModbusTcp::SendRawRequest( uint8_t *aBuffer, uint32_t aSize )
+{
+    if( !IsConnected() )
+    {
+        throw LeddarException::LtNotConnectedException( "Modbus device not connected." );
+    }
+
+    if( aSize < 2 || aSize > MBAP_MAX_LENGTH )
+    {
+        throw std::invalid_argument( "Invalid modbus request size: " + LeddarUtils::LtStringUtils::IntToString( aSize ) );
+    }
+
+    Flush(); // An answer not read anymore
+    ++mCounters->mTransactions;
+    mPending = mChannel->Send( aBuffer, aSize );
+    mCounters->mBytesOut += MBAP_HEADER_SIZE + aSize;
+}
+
+// *****************************************************************************
+// Function: LdLibModbusTcp::WaitAnswer
+//
+/// \brief   Wait for the answer to the last request.
+///
+/// \return  Unit id followed by the PDU of the answer.
+///
+/// \exception LtComException on error or timeout.
+///
+/// \author  David Levy
+///
+/// \since   October 2026
+// *****************************************************************************
+std::vector<uint8_t>
+LeddarConnection::LdLibModbusTcp::WaitAnswer( void )
+{
+    if( mPending < 0 )
+    {
+        throw LeddarException::LtComException( "No modbus request waiting for an answer." );
+    }
+
+    uint16_t lTransaction = static_cast<uint16_t>( mPending );
+    mPending = -1;
+    std::vector<uint8_t> lAnswer;
+
+    try
+    {
+        lAnswer = mChannel->Receive( lTransaction, mConnectionInfoTcp->GetTimeout() );
+    }
+    catch( LeddarException::LtTimeoutException & )
+    {
+        ++mCounters->mTimeouts;
+        throw;
+    }
+
+    // No CRC failure to count, TCP checks the integrity of the frames
+    mCounters->mBytesIn += MBAP_HEADER_SIZE + lAnswer.size();
+    return lAnswer;
+}
+
+// *****************************************************************************
+// Function: LdLibModbusTcp::ReceiveRawConfirmation
+//
+/// \brief   Receive raw confirmation of the last SendRawRequest, in the RTU
+///          layout (modbus address, function code, data, CRC16).
+///
+/// \param   aBuffer    Buffer to receive to
+/// \param   aSize      Expected length of the answer (CRC included), 0 if it is
+///                     undefined. The length comes from the MBAP header either way.
+///
+/// \exception LtComException on error on reception of if an error code in the returned function code.
+///
+/// \author  David Levy
+///
+/// \since   October 2026
+// *****************************************************************************
+size_t
+LeddarConnection::LdLibModbusTcp::ReceiveRawConfirmation( uint8_t *aBuffer, uint32_t aSize )
+{
+    std::vector<uint8_t> lAnswer = WaitAnswer();
+    size_t lSize = lAnswer.size() + MODBUS_CRC_SIZE;
+
+    if( aSize != 0 && lSize > aSize )
+    {
+        throw LeddarException::LtComException( "Unexpected modbus answer size (" + LeddarUtils::LtStringUtils::IntToString( lSize ) + ", expected " +
+                                               LeddarUtils::LtStringUtils::IntToString( aSize ) + ")." );
+    }
+
+    memcpy( aBuffer, &lAnswer[0], lAnswer.size() );
+    uint16_t lCrc = LeddarUtils::LtCRCUtils::ComputeCRC16( aBuffer, lAnswer.size() );
+    aBuffer[lAnswer.size()] = static_cast<uint8_t>( lCrc & 0xFF );
+    aBuffer[lAnswer.size() + 1] = static_cast<uint8_t>( lCrc >> 8 );
+
+    // Check if the received message has an error
+    if( ( aBuffer[ 1 ] >> 7 ) == 1 )
+    {
+        throw LeddarException::LtComException( "Received message has an error." );
+    }
+
+    return lSize;
+}
+
+// *****************************************************************************
+// Function: LdLibModbusTcp::ReceiveRawConfirmationLT
+//
+/// \brief   Receive raw confirmation from command 0x41. The MBAP header gives
+///          the length, no sensor specific parsing is needed.
+///
+/// \param   aBuffer     The buffer to store data into
+/// \param   aDeviceType Type of the device for sensor specific 0x41 command
+///
+/// \return  Number of bytes received.
+///
+/// \author  David Levy
+///
+/// \since   October 2026
+// *****************************************************************************
+int
+LeddarConnection::LdLibModbusTcp::ReceiveRawConfirmationLT( uint8_t *aBuffer, int aDeviceType )
+{
+    if( aDeviceType != LtComLeddarTechPublic::LT_COMM_DEVICE_TYPE_IS16 &&
+            aDeviceType != LtComLeddarTechPublic::LT_COMM_DEVICE_TYPE_M16_EVALKIT &&
+            aDeviceType != LtComLeddarTechPublic::LT_COMM_DEVICE_TYPE_M16 &&
+            aDeviceType != LtComLeddarTechPublic::LT_COMM_DEVICE_TYPE_M16_LASER &&
+            aDeviceType != LtComLeddarTechPublic::LT_COMM_DEVICE_TYPE_VU8 )
+    {
+        Flush();
+        throw std::runtime_error( "LT custom command not supported for this sensor." );
+    }
+
+    return static_cast<int>( ReceiveRawConfirmation( aBuffer, 0 ) );
+}
+
+// *****************************************************************************
+// Function: LdLibModbusTcp::Transaction
+//
+/// \brief   Send a request to the unit id of the connection and wait for the answer.
+///
+/// \param   aPdu   Function code and data.
+/// \param   aSize  Size of aPdu.
+///
+/// \return  Unit id followed by the PDU of the answer.
+///
+/// \exception LtComException on error or if the device answered with an exception.
+///
+/// \author  David Levy
+///
+/// \since   October 2026
+// *****************************************************************************
+std::vector<uint8_t>
+LeddarConnection::LdLibModbusTcp::Transaction( const uint8_t *aPdu, uint32_t aSize )
+{
+    std::vector<uint8_t> lRequest( 1 + aSize );
+    lRequest[0] = mConnectionInfoModbus->GetModbusAddr();
+    memcpy( &lRequest[1], aPdu, aSize );
+
+    SendRawRequest( &lRequest[0], static_cast<uint32_t>( lRequest.size() ) );
+    std::vector<uint8_t> lAnswer = WaitAnswer();
+
+    if( ( lAnswer[1] & 0x80 ) != 0 )
+    {
+        throw LeddarException::LtComException( "Modbus exception " + LeddarUtils::LtStringUtils::IntToString( lAnswer.size() > 2 ? lAnswer[2] : 0 ) +
+                                               " to function " + LeddarUtils::LtStringUtils::IntToString( aPdu[0], 16 ) + "." );
+    }
+
+    if( lAnswer[1] != aPdu[0] )
+    {
+        throw LeddarException::LtComException( "Unexpected modbus function in the answer." );
+    }
+
+    return lAnswer;
+}
+
+// *****************************************************************************
+// Function: LdLibModbusTcp::ReadRegisters
+//
+/// \brief   Read registers on modbus interface (use function 0x03)
+///             You DO NOT need to convert data to/from bug endian
+///
+/// \param   aAddr Address to read from
+/// \param   aNb Number of register to read
+/// \param   aDest Array containing the values of the register
+///
+/// \exception LtComException on error in reading registers
+///
+/// \author  David Levy
+///
+/// \since   October 2026
+// *****************************************************************************
+void
+LeddarConnection::LdLibModbusTcp::ReadRegisters( uint16_t aAddr, uint8_t aNb, uint16_t *aDest )
+{
+    uint8_t lPdu[5] = { 0x03, static_cast<uint8_t>( aAddr >> 8 ), static_cast<uint8_t>( aAddr & 0xFF ), 0, aNb };
+    std::vector<uint8_t> lAnswer = Transaction( lPdu, sizeof( lPdu ) );
+
+    if( lAnswer.size() != 3u + 2u * aNb || lAnswer[2] != 2 * aNb )
+    {
+        throw LeddarException::LtComException( "Error on modbus read registers in ReadRegisters." );
+    }
+
+    for( uint8_t i = 0; i < aNb; ++i )
+    {
+        aDest[i] = ReadBigEndian16( &lAnswer[3 + 2 * i] );
+    }
+}
+
+// *****************************************************************************
+// Function: LdLibModbusTcp::ReadInputRegisters
+//
+/// \brief   Read registers on modbus interface (use function 0x04)
+///             You DO NOT need to convert data to/from bug endian
+///
+/// \param   aAddr Address to read from
+/// \param   aNb Number of register to read
+/// \param   aDest Array containing the values of the register
+///
+/// \exception LtComException on error in reading input registers
+///
+/// \author  David Levy
+///
+/// \since   October 2026
+// *****************************************************************************
+void
+LeddarConnection::LdLibModbusTcp::ReadInputRegisters( uint16_t aAddr, uint8_t aNb, uint16_t *aDest )
+{
+    uint8_t lPdu[5] = { 0x04, static_cast<uint8_t>( aAddr >> 8 ), static_cast<uint8_t>( aAddr & 0xFF ), 0, aNb };
+    std::vector<uint8_t> lAnswer = Transaction( lPdu, sizeof( lPdu ) );
+
+    if( lAnswer.size() != 3u + 2u * aNb || lAnswer[2] != 2 * aNb )
+    {
+        throw LeddarException::LtComException( "Error on modbus read input registers in ReadInputRegisters." );
+    }
+
+    for( uint8_t i = 0; i < aNb; ++i )
+    {
+        aDest[i] = ReadBigEndian16( &lAnswer[3 + 2 * i] );
+    }
+}
+
+// *****************************************************************************
+// Function: LdLibModbusTcp::WriteRegister
+//
+/// \brief   Write registers on modbus interface (use function 0x06)
+///             You DO NOT need to convert data to/from bug endian
+///
+/// \param   aAddr Address to write to
+/// \param   aValue Value to write to the register
+///
+/// \exception LtComException on error in writing register
+///
+/// \author  David Levy
+///
+/// \since   October 2026
+// *****************************************************************************
+void
+LeddarConnection::LdLibModbusTcp::WriteRegister( uint16_t aAddr, int aValue )
+{
+    uint8_t lPdu[5] = { 0x06, static_cast<uint8_t>( aAddr >> 8 ), static_cast<uint8_t>( aAddr & 0xFF ),
+                        static_cast<uint8_t>( ( aValue >> 8 ) & 0xFF ), static_cast<uint8_t>( aValue & 0xFF )
+                      };
+    std::vector<uint8_t> lAnswer = Transaction( lPdu, sizeof( lPdu ) );
+
+    if( lAnswer.size() != 6 || memcmp( &lAnswer[1], lPdu, sizeof( lPdu ) ) != 0 )
+    {
+        throw LeddarException::LtComException( "Error on modbus write register in WriteRegister." );
+    }
+}
+
+// *****************************************************************************
+// Function: LdLibModbusTcp::Flush
+//
+/// \brief   Drop the answer of the last request if it was not read.
+///
+/// \author  David Levy
+///
+/// \since   October 2026
+// *****************************************************************************
+void
+LeddarConnection::LdLibModbusTcp::Flush( void )
+{
+    if( mPending >= 0 )
+    {
+        mChannel->Abandon( static_cast<uint16_t>( mPending ) );
+        mPending = -1;
+    }
+}
+
+#endif
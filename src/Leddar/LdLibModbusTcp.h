@@ -0,0 +1,80 @@
+// *****************************************************************************
+// Module..: Leddar
+//
+/// \file    LdLibModbusTcp.h
+///
+/// \brief   Class definition of LdLibModbusTcp
+///
+/// \author  David Levy
+///
+/// \since   October 2026
+//
+// Copyright (c) 2026 LeddarTech Inc. All rights reserved.
+// *****************************************************************************
+
+#pragma once
+
+#include "LtDefines.h"
+#ifdef BUILD_MODBUS
+
+#include "LdInterfaceModbus.h"
+#include "LdConnectionInfoModbusTcp.h"
+
+#include <memory>
+#include <vector>
+
+namespace LeddarConnection
+{
+    class LdModbusTcpChannel;
+
+    // *****************************************************************************
+    // Class: LdLibModbusTcp
+    //
+    /// \brief   Modbus TCP transport, to a sensor directly or behind a Modbus TCP
+    ///          to RTU gateway.
+    ///
+    ///          The requests and answers keep the RTU layout of LdInterfaceModbus
+    ///          (address, function code, data, CRC) so the Modbus sensors work
+    ///          unchanged: the MBAP header replaces the CRC on the link and a CRC
+    ///          is appended to the answers.
+    ///
+    ///          The connections created with an existing LdLibModbusTcp share its
+    ///          socket. Each request gets a transaction id and the answers are
+    ///          matched on it, so several requests to different unit ids can be
+    ///          outstanding at the same time: from several threads (LdSensorManager),
+    ///          or by calling SendRawRequest on each connection before the
+    ///          ReceiveRawConfirmation.
+    ///
+    /// \author  David Levy
+    ///
+    /// \since   October 2026
+    // *****************************************************************************
+    class LdLibModbusTcp : public LdInterfaceModbus
+    {
+    public:
+        LdLibModbusTcp( const LdConnectionInfoModbusTcp *aConnectionInfo, LdConnection *aExistingConnection = nullptr );
+        virtual            ~LdLibModbusTcp();
+        virtual void        Connect( void ) override;
+        virtual bool        IsConnected( void ) const override;
+        virtual void        Disconnect( void ) override;
+        virtual void        SendRawRequest( uint8_t *aBuffer, uint32_t aSize ) override;
+        virtual size_t      ReceiveRawConfirmation( uint8_t *aBuffer, uint32_t aSize ) override;
+        virtual int         ReceiveRawConfirmationLT( uint8_t *aBuffer, int aDeviceType ) override;
+        virtual void        ReadRegisters( uint16_t aAddr, uint8_t aNb, uint16_t *aDest ) override;
+        virtual void        ReadInputRegisters( uint16_t aAddr, uint8_t aNb, uint16_t *aDest ) override;
+        virtual void        WriteRegister( uint16_t aAddr, int aValue ) override;
+        virtual void        Flush( void ) override;
+
+        virtual bool        IsVirtualCOMPort( void ) override { return false; }
+
+    protected:
+        std::vector<uint8_t> Transaction( const uint8_t *aPdu, uint32_t aSize );
+        std::vector<uint8_t> WaitAnswer( void );
+
+        const LdConnectionInfoModbusTcp     *mConnectionInfoTcp;
+        std::shared_ptr<LdModbusTcpChannel> mChannel;       ///< Socket shared by the connections to the same gateway, closed with the last one
+        int32_t                             mPending;       ///< Transaction id of the request waiting for its answer, -1 if none
+    };
+}
+
+#endif
@@ -22,8 +22,10 @@
 
 #include "comm/LtComUSBPublic.h"
 
+#include <algorithm>
 #include <cstring>
 #include <sstream>
+#include <stdexcept>
 
 #ifdef _WIN32
 #include "libusb.h"
@@ -33,6 +35,19 @@
 
 using namespace LeddarConnection;
 
+namespace LeddarConnection
+{
+    // Trampoline with the libusb calling convention, friend of LdLibUsb
+    struct LdLibUsbAsyncCallback
+    {
+        static void LIBUSB_CALL Callback( libusb_transfer *aTransfer )
+        {
+            LdLibUsb::sAsyncTransfer *lAsync = static_cast<LdLibUsb::sAsyncTransfer *>( aTransfer->user_data );
+            lAsync->mOwner->AsyncCompleted( lAsync );
+        }
+    };
+}
+
 libusb_context *LdLibUsb::mContext = nullptr;
 
 /// *****************************************************************************
@@ -51,7 +66,11 @@ LdLibUsb::LdLibUsb( const LdConnectionInfoUsb *aConnectionInfo, LdConnection *aI
     LdInterfaceUsb( aConnectionInfo, aInterface ),
     mHandle( nullptr ),
     mReadTimeout( 1000 ),
-    mWriteTimeout( 1000 )
+    mWriteTimeout( 1000 ),
+    mAsyncEndPoint( 0 ),
+    mAsyncInFlight( 0 ),
+    mAsyncError( 0 ),
+    mAsyncStop( false )
 {
 
 }
@@ -67,6 +86,7 @@ LdLibUsb::LdLibUsb( const LdConnectionInfoUsb *aConnectionInfo, LdConnection *aI
 /// *****************************************************************************
 LdLibUsb::~LdLibUsb()
 {
+    StopAsyncRead();
 }
 
 
@@ -324,6 +344,8 @@ LdLibUsb::Connect( void )
 void
 LdLibUsb::Disconnect( void )
 {
+    StopAsyncRead();
+
     if( mHandle != nullptr )
     {
         libusb_release_interface( mHandle, 0 );
@@ -399,6 +421,12 @@ LdLibUsb::Context( void )
 void
 LdLibUsb::Read( uint8_t aEndPoint, uint8_t *aData, uint32_t aSize )
 {
+    if( !mAsyncTransfers.empty() && aEndPoint == mAsyncEndPoint )
+    {
+        ReadAsync( aData, aSize );
+        return;
+    }
+
     int lLen = 0;
     // Add the direction bit to the endpoint, bit 7: 0 = Write, 1 = Read
     VerifyError( libusb_bulk_transfer( mHandle, aEndPoint | LIBUSB_ENDPOINT_IN, aData, aSize, &lLen, mReadTimeout ) );
@@ -453,4 +481,306 @@ LdLibUsb::ControlTransfert( uint8_t aRequestType, uint8_t aRequest, uint8_t *aDa
     memcpy( aData, lBuffer, aSize );
 }
 
+// *****************************************************************************
+// Function: LdLibUsb::StartAsyncRead
+//
+/// \brief   Start the asynchronous read mode on an endpoint.
+///          aTransferCount bulk transfers are kept submitted, so the device can send a frame even when the host
+///          is not in Read. A thread handles the libusb events. Read on this endpoint returns the oldest completed
+///          transfer and submits it again. Read on the other endpoints stays synchronous.
+///
+/// \param   aEndPoint      Endpoint to read (without the direction bit).
+/// \param   aTransferSize  Size of each transfer, the size of the largest message.
+/// \param   aTransferCount Number of transfers in the ring.
+///
+/// \exception std::invalid_argument if aTransferSize or aTransferCount is 0
+/// \exception LtComException if the device is not connected, the mode is already started or a transfer cannot be submitted
+///
+/// \author  David Levy
+///
+/// \since   October 2026
+// *****************************************************************************
+
+void
+LdLibUsb::StartAsyncRead( uint8_t aEndPoint, uint32_t aTransferSize, size_t aTransferCount )
+{
+    if( aTransferSize == 0 || aTransferCount == 0 )
+    {
+        throw std::invalid_argument( "Invalid transfer size or count." );
+    }
+
+    if( mHandle == nullptr )
+    {
+        throw LeddarException::LtComException( "USB device not connected." );
+    }
+
+    if( !mAsyncTransfers.empty() )
+    {
+        throw LeddarException::LtComException( "USB asynchronous read already started." );
+    }
+
+    mAsyncEndPoint = aEndPoint;
+    mAsyncStop = false;
+    mAsyncError = 0;
+
+    for( size_t i = 0; i < aTransferCount; ++i )
+    {
+        sAsyncTransfer *lAsync = new sAsyncTransfer;
+        lAsync->mOwner = this;
+        lAsync->mTransfer = libusb_alloc_transfer( 0 );
+        lAsync->mBuffer.resize( aTransferSize );
+        lAsync->mInFlight = false;
+        mAsyncTransfers.push_back( lAsync );
+
+        if( lAsync->mTransfer == nullptr )
+        {
+            StopAsyncRead();
+            throw LeddarException::LtComException( "Unable to allocate USB transfer." );
+        }
+
+        // No timeout, the transfer waits for the next frame
+        libusb_fill_bulk_transfer( lAsync->mTransfer, mHandle, aEndPoint | LIBUSB_ENDPOINT_IN, &lAsync->mBuffer[0], aTransferSize,
+                                   &LdLibUsbAsyncCallback::Callback, lAsync, 0 );
+    }
+
+    mAsyncThread = std::thread( &LdLibUsb::RunAsyncEvents, this );
+
+    try
+    {
+        std::lock_guard<std::mutex> lLock( mAsyncMutex );
+
+        for( size_t i = 0; i < mAsyncTransfers.size(); ++i )
+        {
+            SubmitAsync( mAsyncTransfers[i] );
+        }
+    }
+    catch( ... )
+    {
+        StopAsyncRead();
+        throw;
+    }
+}
+
+// *****************************************************************************
+// Function: LdLibUsb::StopAsyncRead
+//
+/// \brief   Stop the asynchronous read mode: cancel the transfers, wait for them and free them.
+///          Completed transfers that were not read are lost. Does nothing if the mode is not started.
+///
+/// \author  David Levy
+///
+/// \since   October 2026
+// *****************************************************************************
+
+void
+LdLibUsb::StopAsyncRead( void )
+{
+    if( mAsyncTransfers.empty() )
+    {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lLock( mAsyncMutex );
+        mAsyncStop = true;
+
+        for( size_t i = 0; i < mAsyncTransfers.size(); ++i )
+        {
+            if( mAsyncTransfers[i]->mInFlight )
+            {
+                libusb_cancel_transfer( mAsyncTransfers[i]->mTransfer );
+            }
+        }
+    }
+
+    mAsyncCondition.notify_all();
+
+    // The event thread ends when all the cancelled transfers are back
+    if( mAsyncThread.joinable() )
+    {
+        mAsyncThread.join();
+    }
+
+    for( size_t i = 0; i < mAsyncTransfers.size(); ++i )
+    {
+        if( mAsyncTransfers[i]->mTransfer != nullptr )
+        {
+            libusb_free_transfer( mAsyncTransfers[i]->mTransfer );
+        }
+
+        delete mAsyncTransfers[i];
+    }
+
+    mAsyncTransfers.clear();
+    mAsyncCompleted.clear();
+    mAsyncInFlight = 0;
+}
+
+// *****************************************************************************
+// Function: LdLibUsb::ReadAsync
+//
+/// \brief   Copy the oldest completed transfer to the buffer and submit it again.
+///
+/// \param   aData   Buffer to store device reading
+/// \param   aSize   Size of the buffer
+///
+/// \exception LtTimeoutException if no transfer completes within the read timeout
+/// \exception LtComException if a transfer failed
+///
+/// \author  David Levy
+///
+/// \since   October 2026
+// *****************************************************************************
+
+void
+LdLibUsb::ReadAsync( uint8_t *aData, uint32_t aSize )
+{
+    std::unique_lock<std::mutex> lLock( mAsyncMutex );
+
+    if( mAsyncCompleted.empty() && mAsyncError == 0 )
+    {
+        mAsyncCondition.wait_for( lLock, std::chrono::milliseconds( mReadTimeout ), [this] { return !mAsyncCompleted.empty() || mAsyncError != 0 || mAsyncStop; } );
+    }
+
+    if( mAsyncCompleted.empty() )
+    {
+        int lError = mAsyncError != 0 ? mAsyncError : LIBUSB_ERROR_TIMEOUT;
+        mAsyncError = 0;
+
+        // A failed transfer is idle, submit it again unless the device is gone
+        if( lError != LIBUSB_ERROR_NO_DEVICE && !mAsyncStop )
+        {
+            for( size_t i = 0; i < mAsyncTransfers.size(); ++i )
+            {
+                if( !mAsyncTransfers[i]->mInFlight && std::find( mAsyncCompleted.begin(), mAsyncCompleted.end(), mAsyncTransfers[i] ) == mAsyncCompleted.end() )
+                {
+                    SubmitAsync( mAsyncTransfers[i] );
+                }
+            }
+        }
+
+        VerifyError( lError );
+    }
+
+    sAsyncTransfer *lAsync = mAsyncCompleted.front();
+    mAsyncCompleted.pop_front();
+
+    uint32_t lLength = static_cast<uint32_t>( lAsync->mTransfer->actual_length );
+    memcpy( aData, &lAsync->mBuffer[0], lLength < aSize ? lLength : aSize );
+
+    SubmitAsync( lAsync );
+}
+
+// *****************************************************************************
+// Function: LdLibUsb::SubmitAsync
+//
+/// \brief   Submit a transfer of the ring, mAsyncMutex must be held.
+///
+/// \param   aTransfer Transfer to submit
+///
+/// \exception LtComException if libusb_submit_transfer fails
+///
+/// \author  David Levy
+///
+/// \since   October 2026
+// *****************************************************************************
+
+void
+LdLibUsb::SubmitAsync( sAsyncTransfer *aTransfer )
+{
+    VerifyError( libusb_submit_transfer( aTransfer->mTransfer ) );
+    aTransfer->mInFlight = true;
+    ++mAsyncInFlight;
+}
+
+// *****************************************************************************
+// Function: LdLibUsb::AsyncCompleted
+//
+/// \brief   Called from the event thread when a transfer of the ring completes, fails or is cancelled.
+///
+/// \param   aTransfer The transfer
+///
+/// \author  David Levy
+///
+/// \since   October 2026
+// *****************************************************************************
+
+void
+LdLibUsb::AsyncCompleted( sAsyncTransfer *aTransfer )
+{
+    {
+        std::lock_guard<std::mutex> lLock( mAsyncMutex );
+        aTransfer->mInFlight = false;
+        --mAsyncInFlight;
+
+        switch( aTransfer->mTransfer->status )
+        {
+            case LIBUSB_TRANSFER_COMPLETED:
+                if( !mAsyncStop )
+                {
+                    mAsyncCompleted.push_back( aTransfer );
+                }
+
+                break;
+
+            case LIBUSB_TRANSFER_CANCELLED:
+                break;
+
+            case LIBUSB_TRANSFER_NO_DEVICE:
+                mAsyncError = LIBUSB_ERROR_NO_DEVICE;
+                break;
+
+            case LIBUSB_TRANSFER_STALL:
+                mAsyncError = LIBUSB_ERROR_PIPE;
+                break;
+
+            case LIBUSB_TRANSFER_OVERFLOW:
+                mAsyncError = LIBUSB_ERROR_OVERFLOW;
+                break;
+
+            case LIBUSB_TRANSFER_TIMED_OUT:
+                mAsyncError = LIBUSB_ERROR_TIMEOUT;
+                break;
+
+            default:
+                mAsyncError = LIBUSB_ERROR_IO;
+                break;
+        }
+    }
+
+    mAsyncCondition.notify_all();
+}
+
+// *****************************************************************************
+// Function: LdLibUsb::RunAsyncEvents
+//
+/// \brief   Event thread of the asynchronous read mode. Ends when stopped and no transfer is in flight.
+///
+/// \author  David Levy
+///
+/// \since   October 2026
+// *****************************************************************************
+
+void
+LdLibUsb::RunAsyncEvents( void )
+{
+    for( ;; )
+    {
+        {
+            std::lock_guard<std::mutex> lLock( mAsyncMutex );
+
+            if( mAsyncStop && mAsyncInFlight == 0 )
+            {
+                break;
+            }
+        }
+
+        struct timeval lTimeout;
+        lTimeout.tv_sec = 0;
+        lTimeout.tv_usec = 100000;
+
+        libusb_handle_events_timeout_completed( Context(), &lTimeout, nullptr );
+    }
+}
+
 #endif
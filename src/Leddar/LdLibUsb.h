@@ -20,10 +20,15 @@
 #include "LdInterfaceUsb.h"
 #include "LdConnectionInfo.h"
 
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
 #include <vector>
 
 class libusb_context;
 class libusb_device_handle;
+struct libusb_transfer;
 
 
 namespace LeddarConnection
@@ -42,6 +47,10 @@ namespace LeddarConnection
         virtual void Write( uint8_t aEndPoint, uint8_t *aData, uint32_t aSize ) override;
         virtual void ControlTransfert( uint8_t aRequestType, uint8_t aRequest, uint8_t *aData, uint32_t aSize, uint16_t aTimeout = 1000 ) override;
 
+        virtual void StartAsyncRead( uint8_t aEndPoint, uint32_t aTransferSize, size_t aTransferCount ) override;
+        virtual void StopAsyncRead( void ) override;
+        bool         IsAsyncRead( void ) const { return !mAsyncTransfers.empty(); }
+
         static std::vector<LdConnectionInfo *> GetDeviceList( uint32_t aVendorId = 0, uint32_t aProductId = 0, const std::string &aSerialNumber = "" );
 
     protected:
@@ -49,11 +58,36 @@ namespace LeddarConnection
         libusb_device_handle *mHandle;
 
     private:
+        struct sAsyncTransfer
+        {
+            LdLibUsb               *mOwner;
+            libusb_transfer        *mTransfer;
+            std::vector<uint8_t>    mBuffer;
+            bool                    mInFlight;
+        };
+
+        friend struct LdLibUsbAsyncCallback;
+
         static void VerifyError( int aCode );
+        void        AsyncCompleted( sAsyncTransfer *aTransfer );
+        void        ReadAsync( uint8_t *aData, uint32_t aSize );
+        void        SubmitAsync( sAsyncTransfer *aTransfer );
+        void        RunAsyncEvents( void );
         static libusb_context *mContext;
 
         uint32_t mReadTimeout;
         uint32_t mWriteTimeout;
+
+        // Asynchronous read mode
+        uint8_t                         mAsyncEndPoint;
+        std::vector<sAsyncTransfer *>   mAsyncTransfers;
+        std::deque<sAsyncTransfer *>    mAsyncCompleted;    ///< Completed transfers, oldest first
+        size_t                          mAsyncInFlight;
+        int                             mAsyncError;        ///< libusb error of a failed transfer, reported by the next Read
+        bool                            mAsyncStop;
+        std::mutex                      mAsyncMutex;
+        std::condition_variable         mAsyncCondition;
+        std::thread                     mAsyncThread;
     };
 
 }
@@ -518,17 +518,17 @@ void LeddarRecord::LdLjrRecorder::EchoesCallback()
     mWriter->StartArray(); //echoes
 
     mEchoes->Lock( LeddarConnection::B_GET );
-    std::vector<LeddarConnection::LdEcho> &lEchoes = *( mEchoes->GetEchoes( LeddarConnection::B_GET ) );
     double lAmpScale = static_cast<double>( mEchoes->GetAmplitudeScale() );
     double lDistScale = static_cast<double>( mEchoes->GetDistanceScale() );
 
     for( size_t i = 0; i < mEchoes->GetEchoCount( LeddarConnection::B_GET ); ++i )
     {
+        LeddarConnection::LdEcho lEcho = mEchoes->GetEcho( i, LeddarConnection::B_GET );
         mWriter->StartArray(); //echo
-        mWriter->Uint( lEchoes[i].mChannelIndex );
-        mWriter->Double( lEchoes[i].mDistance / lDistScale );
-        mWriter->Double( lEchoes[i].mAmplitude / lAmpScale );
-        mWriter->Uint( lEchoes[i].mFlag );
+        mWriter->Uint( lEcho.mChannelIndex );
+        mWriter->Double( lEcho.mDistance / lDistScale );
+        mWriter->Double( lEcho.mAmplitude / lAmpScale );
+        mWriter->Uint( lEcho.mFlag );
         mWriter->EndArray(); //echo
     }
 
@@ -8,6 +8,8 @@
 
 #include "LdObject.h"
 
+#include <algorithm>
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// \fn LeddarCore::LdObject::LdObject( void )
 ///
@@ -16,7 +18,10 @@
 /// \author Patrick Boulay
 /// \date   January 2016
 ////////////////////////////////////////////////////////////////////////////////////////////////////
-LeddarCore::LdObject::LdObject( void )
+LeddarCore::LdObject::LdObject( void ) :
+    mReceiverCount( 0 ),
+    mEmitDepth( 0 ),
+    mNeedCompact( false )
 {
 }
 
@@ -47,17 +52,19 @@ LeddarCore::LdObject::~LdObject( void )
 void
 LeddarCore::LdObject::ConnectSignal( LdObject *aSender, const SIGNALS aSignal )
 {
-    std::pair<std::multimap< LdObject *, SIGNALS>::iterator, std::multimap< LdObject *, SIGNALS>::iterator> lRange = mReceiverMap.equal_range( aSender );
+    std::vector< LdObject * > &lReceivers = mReceivers[aSignal];
 
-    for( std::multimap< LdObject *, SIGNALS>::iterator lIter = lRange.first; lIter != lRange.second; ++lIter )
+    for( size_t i = 0; i < lReceivers.size(); ++i )
     {
-        if( lIter->second == aSignal && lIter->first == aSender )
+        if( lReceivers[i] == aSender )
         {
             throw std::logic_error( "This object is already connected to this signal" );
         }
     }
 
-    mReceiverMap.insert( std::make_pair( aSender, aSignal ) );
+    // Receivers connected during an emission are only called on the next one
+    lReceivers.push_back( aSender );
+    ++mReceiverCount;
 
     aSender->mConnectedObject.insert( this );
 }
@@ -76,24 +83,29 @@ LeddarCore::LdObject::ConnectSignal( LdObject *aSender, const SIGNALS aSignal )
 void
 LeddarCore::LdObject::DisconnectSignal( LdObject *aSender, const SIGNALS aSignal )
 {
-    std::pair<std::multimap< LdObject *, SIGNALS>::iterator, std::multimap< LdObject *, SIGNALS>::iterator> lRange = mReceiverMap.equal_range( aSender );
-
-    if( lRange.first == mReceiverMap.end() )
-    {
-        return;
-    }
+    std::vector< LdObject * > &lReceivers = mReceivers[aSignal];
 
-    for( std::multimap< LdObject *, SIGNALS>::iterator lIter = lRange.first; lIter != lRange.second; ++lIter )
+    for( size_t i = 0; i < lReceivers.size(); ++i )
     {
-        if( lIter->second == aSignal && lIter->first == aSender )
+        if( lReceivers[i] == aSender )
         {
-            mReceiverMap.erase( lIter );
+            if( mEmitDepth > 0 )
+            {
+                lReceivers[i] = nullptr;
+                mNeedCompact = true;
+            }
+            else
+            {
+                lReceivers.erase( lReceivers.begin() + i );
+            }
+
+            --mReceiverCount;
             break;
         }
     }
 
     // If there is no aSender object, we need to remove this object in the mConnectedObject
-    if( mReceiverMap.find( aSender ) == mReceiverMap.end() )
+    if( !IsConnected( aSender ) )
     {
         aSender->mConnectedObject.erase( this );
     }
@@ -111,22 +123,135 @@ void
 LeddarCore::LdObject::DisconnectAll( void )
 {
     // Delete links between the receiver and this object
-    for( std::multimap< LdObject *, SIGNALS>::iterator lIter = mReceiverMap.begin(); lIter != mReceiverMap.end(); ++lIter )
+    for( size_t lSignal = 0; lSignal < SIGNAL_COUNT; ++lSignal )
     {
-        ( *lIter ).first->mConnectedObject.erase( this );
+        std::vector< LdObject * > &lReceivers = mReceivers[lSignal];
+
+        for( size_t i = 0; i < lReceivers.size(); ++i )
+        {
+            if( lReceivers[i] != nullptr )
+            {
+                lReceivers[i]->mConnectedObject.erase( this );
+
+                if( mEmitDepth > 0 )
+                {
+                    lReceivers[i] = nullptr;
+                    mNeedCompact = true;
+                }
+            }
+        }
+
+        if( mEmitDepth == 0 )
+        {
+            lReceivers.clear();
+        }
     }
 
+    mReceiverCount = 0;
+
     // Delete links between this object and receiver
     for( std::set< LdObject * >::iterator lIter = mConnectedObject.begin(); lIter != mConnectedObject.end(); ++lIter )
     {
-        ( *lIter )->mReceiverMap.erase( this );
+        ( *lIter )->RemoveReceiver( this );
+    }
+
+    mConnectedObject.clear();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn bool LeddarCore::LdObject::IsConnected( const LdObject *aReceiver ) const
+///
+/// \brief  Check if aReceiver is connected to any signal of this object.
+///
+/// \param  aReceiver   The receiver.
+///
+/// \author David Levy
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool
+LeddarCore::LdObject::IsConnected( const LdObject *aReceiver ) const
+{
+    for( size_t lSignal = 0; lSignal < SIGNAL_COUNT; ++lSignal )
+    {
+        const std::vector< LdObject * > &lReceivers = mReceivers[lSignal];
+
+        for( size_t i = 0; i < lReceivers.size(); ++i )
+        {
+            if( lReceivers[i] == aReceiver )
+            {
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LeddarCore::LdObject::RemoveReceiver( LdObject *aReceiver )
+///
+/// \brief  Remove aReceiver from all signals of this object. If this object is emitting, the entries are nulled
+///         and removed at the end of the emission.
+///
+/// \param [in] aReceiver   The receiver.
+///
+/// \author David Levy
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void
+LeddarCore::LdObject::RemoveReceiver( LdObject *aReceiver )
+{
+    for( size_t lSignal = 0; lSignal < SIGNAL_COUNT; ++lSignal )
+    {
+        std::vector< LdObject * > &lReceivers = mReceivers[lSignal];
+
+        for( size_t i = 0; i < lReceivers.size(); ++i )
+        {
+            if( lReceivers[i] == aReceiver )
+            {
+                if( mEmitDepth > 0 )
+                {
+                    lReceivers[i] = nullptr;
+                    mNeedCompact = true;
+                }
+                else
+                {
+                    lReceivers.erase( lReceivers.begin() + i );
+                }
+
+                --mReceiverCount;
+                break;
+            }
+        }
     }
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LeddarCore::LdObject::Compact( void )
+///
+/// \brief  Remove the null entries left by receivers disconnected during an emission.
+///
+/// \author David Levy
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void
+LeddarCore::LdObject::Compact( void )
+{
+    for( size_t lSignal = 0; lSignal < SIGNAL_COUNT; ++lSignal )
+    {
+        std::vector< LdObject * > &lReceivers = mReceivers[lSignal];
+        lReceivers.erase( std::remove( lReceivers.begin(), lReceivers.end(), static_cast<LdObject *>( nullptr ) ), lReceivers.end() );
+    }
+
+    mNeedCompact = false;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// \fn void LeddarCore::LdObject::EmitSignal( const SIGNALS aSignal, void *aExtraData )
 ///
 /// \brief  Notify all connected object.
+///         Only the receivers of aSignal are visited. Receivers can connect or disconnect (themselves or others) from the callback:
+///         a disconnected receiver is not called anymore, a newly connected one is called from the next emission.
 ///
 /// \param          aSignal     Notification signal.
 /// \param [in,out] aExtraData  If non-null, information describing the extra.
@@ -137,11 +262,41 @@ LeddarCore::LdObject::DisconnectAll( void )
 void
 LeddarCore::LdObject::EmitSignal( const SIGNALS aSignal, void *aExtraData )
 {
-    for( std::multimap< LdObject *, SIGNALS>::iterator lIter = mReceiverMap.begin(); lIter != mReceiverMap.end(); ++lIter )
+    std::vector< LdObject * > &lReceivers = mReceivers[aSignal];
+    const size_t lCount = lReceivers.size();
+
+    if( lCount == 0 )
     {
-        if( lIter->second == aSignal )
+        return;
+    }
+
+    ++mEmitDepth;
+
+    try
+    {
+        // Index access: the vector can grow (and move) if a callback connects a new receiver
+        for( size_t i = 0; i < lCount; ++i )
         {
-            lIter->first->Callback( this, lIter->second, aExtraData );
+            LdObject *lReceiver = lReceivers[i];
+
+            if( lReceiver != nullptr )
+            {
+                lReceiver->Callback( this, aSignal, aExtraData );
+            }
         }
     }
+    catch( ... )
+    {
+        if( --mEmitDepth == 0 && mNeedCompact )
+        {
+            Compact();
+        }
+
+        throw;
+    }
+
+    if( --mEmitDepth == 0 && mNeedCompact )
+    {
+        Compact();
+    }
 }
@@ -11,9 +11,9 @@
 #include "LtDefines.h"
 
 #include <cstddef>
-#include <map>
 #include <set>
 #include <stdexcept>
+#include <vector>
 
 namespace LeddarCore
 {
@@ -32,28 +32,36 @@ namespace LeddarCore
                         DISCONNECTED,
                         VALUE_CHANGED,
                         LIMITS_CHANGED,
-                        NEW_DATA
+                        NEW_DATA,
+                        DEVICE_ID_CHANGED
                      };
+        static const size_t SIGNAL_COUNT = DEVICE_ID_CHANGED + 1;
 
         LdObject( void );
         virtual ~LdObject( void );
 
         void ConnectSignal( LdObject *aSender, const SIGNALS aSignal );
         void DisconnectSignal( LdObject *aSender, const SIGNALS aSignal );
-        size_t GetConnectedObjectsSize( void ) const { return mReceiverMap.size(); }
+        size_t GetConnectedObjectsSize( void ) const { return mReceiverCount; }
         virtual void Callback( LdObject * /*aSender*/, const SIGNALS /*aSignal*/, void * /*aExtraData*/ ) {};
 
     protected:
         void EmitSignal( const SIGNALS aSignal, void *aExtraData = nullptr );
+        void DisconnectAll( void );
 
     private:
         LdObject(const LdObject &aObj);
         LdObject& operator=(const LdObject &aObj);
 
-        void DisconnectAll( void );
+        bool IsConnected( const LdObject *aReceiver ) const;
+        void RemoveReceiver( LdObject *aReceiver );
+        void Compact( void );
 
-        std::set< LdObject * > mConnectedObject;
-        std::multimap< LdObject *, SIGNALS> mReceiverMap;
+        std::set< LdObject * > mConnectedObject;                    ///< Objects this object receives signals from
+        std::vector< LdObject * > mReceivers[SIGNAL_COUNT];         ///< Receivers of each signal. Null entries are receivers removed during an emission
+        size_t mReceiverCount;                                      ///< Number of (receiver, signal) connections
+        unsigned int mEmitDepth;                                    ///< Number of EmitSignal in progress on this object (callbacks can emit again)
+        bool mNeedCompact;                                          ///< Null entries to remove once the emissions are done
     };
 
 }
@@ -31,7 +31,8 @@
 // *****************************************************************************
 
 LeddarCore::LdPropertiesContainer::LdPropertiesContainer() :
-    mIsPropertiesOwner( true )
+    mIsPropertiesOwner( true ),
+    mArena( std::make_shared< LeddarCore::LdPropertyArena >() )
 {
 
 }
@@ -296,6 +297,7 @@ LeddarCore::LdPropertiesContainer::GetBufferProperty( uint32_t aId )
 // Function: LdPropertiesContainer::AddProperty
 //
 /// \brief   Add property to the properies map - Take ownership of the pointer
+///          The values of the property move to the storage of the container (see LdPropertyArena).
 ///
 /// \exception std::invalid_argument If property pointer is not valid.
 ///
@@ -318,20 +320,60 @@ LeddarCore::LdPropertiesContainer::AddProperty( LeddarCore::LdProperty *aPropert
         throw std::invalid_argument( "Property id already exist, id: " + LeddarUtils::LtStringUtils::IntToString( aProperty->GetId(), 16 ) );
     }
 
-    if( aProperty->GetDeviceId() != 0 )
+    if( aProperty->GetDeviceId() != 0 && mDeviceIdIndex.find( aProperty->GetDeviceId() ) != mDeviceIdIndex.end() )
     {
-        for( std::map< uint32_t, LeddarCore::LdProperty *>::iterator it = mProperties.begin(); it != mProperties.end(); it++ ) //begin/end -> cbegin/cend for c++98
-        {
-            if( it->second->GetDeviceId() == aProperty->GetDeviceId() )
-            {
-                throw std::invalid_argument( "Property device id already exist, id: " + LeddarUtils::LtStringUtils::IntToString( aProperty->GetDeviceId(), 16 ) );
-            }
-        }
+        throw std::invalid_argument( "Property device id already exist, id: " + LeddarUtils::LtStringUtils::IntToString( aProperty->GetDeviceId(), 16 ) );
     }
 
     aProperty->ConnectSignal( this, VALUE_CHANGED );
+    aProperty->ConnectSignal( this, DEVICE_ID_CHANGED );
 
     mProperties.insert( std::make_pair( aProperty->GetId(), aProperty ) );
+    IndexDeviceId( aProperty );
+    aProperty->SetArena( mArena );
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LeddarCore::LdPropertiesContainer::IndexDeviceId( LeddarCore::LdProperty *aProperty )
+///
+/// \brief  Add a property to the device id index.
+///         Several properties can share a device id (0, or after a SetDeviceId): the one with the lowest id is kept,
+///         as the linear search in id order used to return.
+///
+/// \param [in]    aProperty   The property.
+///
+/// \author David Levy
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void
+LeddarCore::LdPropertiesContainer::IndexDeviceId( LeddarCore::LdProperty *aProperty )
+{
+    std::pair< std::unordered_map< uint32_t, LeddarCore::LdProperty *>::iterator, bool > lResult =
+        mDeviceIdIndex.insert( std::make_pair( aProperty->GetDeviceId(), aProperty ) );
+
+    if( !lResult.second && lResult.first->second->GetId() > aProperty->GetId() )
+    {
+        lResult.first->second = aProperty;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LeddarCore::LdPropertiesContainer::RebuildDeviceIdIndex( void )
+///
+/// \brief  Rebuild the device id index from the properties.
+///
+/// \author David Levy
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void
+LeddarCore::LdPropertiesContainer::RebuildDeviceIdIndex( void )
+{
+    mDeviceIdIndex.clear();
+
+    for( std::map< uint32_t, LeddarCore::LdProperty *>::const_iterator lIter = mProperties.begin(); lIter != mProperties.end(); ++lIter )
+    {
+        IndexDeviceId( lIter->second );
+    }
 }
 
 // *****************************************************************************
@@ -365,6 +407,7 @@ LeddarCore::LdPropertiesContainer::FindProperty( uint32_t aId )
 // Function: LdPropertiesContainer::FindDeviceProperty
 ///
 /// \brief   Find a property from the device id.
+///          Hashed lookup: called for every element of the states and config messages.
 //
 /// \param   aDeviceId Device id of the property
 ///
@@ -378,15 +421,14 @@ LeddarCore::LdPropertiesContainer::FindProperty( uint32_t aId )
 LeddarCore::LdProperty *
 LeddarCore::LdPropertiesContainer::FindDeviceProperty( uint32_t aDeviceId )
 {
-    for( std::map< uint32_t, LeddarCore::LdProperty *>::const_iterator lIter = mProperties.begin(); lIter != mProperties.end(); ++lIter )
+    std::unordered_map< uint32_t, LeddarCore::LdProperty *>::const_iterator lIter = mDeviceIdIndex.find( aDeviceId );
+
+    if( lIter == mDeviceIdIndex.end() )
     {
-        if( lIter->second->GetDeviceId() == aDeviceId )
-        {
-            return lIter->second;
-        }
+        return nullptr;
     }
 
-    return nullptr;
+    return lIter->second;
 }
 
 // *****************************************************************************
@@ -451,6 +493,7 @@ LeddarCore::LdPropertiesContainer::FindPropertiesByFeature( uint32_t aFeature )
 // Function: LdPropertiesContainer::Callback
 ///
 /// \brief   Emit a signal when one of the property is modified.
+///          Update the device id index when the device id of a property changes.
 //
 /// \param   aSender Property that send the signal.
 /// \param   aSignal Signal sent.
@@ -468,6 +511,11 @@ LeddarCore::LdPropertiesContainer::Callback( LdObject *aSender, const SIGNALS aS
         // The extra info is the pointer to the modified property.
         EmitSignal( VALUE_CHANGED, aSender );
     }
+    else if( aSignal == DEVICE_ID_CHANGED )
+    {
+        // Rare (sensor setup): the previous device id can be shared, rebuild rather than patch.
+        RebuildDeviceIdIndex();
+    }
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
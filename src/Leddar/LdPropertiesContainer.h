@@ -23,6 +23,10 @@
 #include "LdBufferProperty.h"
 #include "LdProperty.h"
 
+#include <map>
+#include <memory>
+#include <unordered_map>
+
 
 namespace LeddarCore
 {
@@ -56,7 +60,12 @@ namespace LeddarCore
 
         virtual void Callback( LdObject *aSender, const SIGNALS aSignal, void * /*aExtraData*/ ) override;
     private:
+        void IndexDeviceId( LeddarCore::LdProperty *aProperty );
+        void RebuildDeviceIdIndex( void );
+
         bool mIsPropertiesOwner;
         std::map< uint32_t, LeddarCore::LdProperty *> mProperties;
+        std::unordered_map< uint32_t, LeddarCore::LdProperty *> mDeviceIdIndex; ///< Device id -> property (lowest id if several share a device id), for FindDeviceProperty
+        std::shared_ptr< LeddarCore::LdPropertyArena > mArena; ///< Values of the properties added to the container
     };
 }
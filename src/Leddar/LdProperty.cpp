@@ -36,6 +36,7 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 LeddarCore::LdProperty::LdProperty( ePropertyType aPropertyType, eCategories aCategory, uint32_t aFeatures, uint32_t aId,
                                     uint32_t aDeviceId, uint32_t aUnitSize, size_t aStride, const std::string &aDescription ) :
+    mCheckEditable( true ),
     mCategory( aCategory ),
     mFeatures( aFeatures ),
     mId( aId ),
@@ -45,7 +46,9 @@ LeddarCore::LdProperty::LdProperty( ePropertyType aPropertyType, eCategories aCa
     mInitialized( false ),
     mStride( aStride ),
     mUnitSize( aUnitSize ),
-    mCheckEditable( true )
+    mValues( nullptr ),
+    mSize( 0 ),
+    mCapacity( 0 )
 {
     assert( aId && aUnitSize );
 
@@ -55,6 +58,28 @@ LeddarCore::LdProperty::LdProperty( ePropertyType aPropertyType, eCategories aCa
     }
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LeddarCore::LdProperty::SetDeviceId( uint16_t aDeviceId )
+///
+/// \brief  Change the id used by the device for this property.
+///         Emits DEVICE_ID_CHANGED (extra data: pointer to the previous device id) so the containers can update their index.
+///
+/// \param  aDeviceId   The new device id.
+///
+/// \author David Levy
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void
+LeddarCore::LdProperty::SetDeviceId( uint16_t aDeviceId )
+{
+    if( aDeviceId != mDeviceId )
+    {
+        uint32_t lOldDeviceId = mDeviceId;
+        mDeviceId = aDeviceId;
+        EmitSignal( DEVICE_ID_CHANGED, &lOldDeviceId );
+    }
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// \fn bool LeddarCore::LdProperty::Modified( void ) const
 ///
@@ -69,7 +94,7 @@ LeddarCore::LdProperty::LdProperty( ePropertyType aPropertyType, eCategories aCa
 bool
 LeddarCore::LdProperty::Modified( void ) const
 {
-    return ( mStorage != mBackupStorage );
+    return mSize != 0 && memcmp( mValues, mValues + mCapacity, mSize ) != 0;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -83,7 +108,10 @@ LeddarCore::LdProperty::Modified( void ) const
 void
 LeddarCore::LdProperty::SetClean( void )
 {
-    mBackupStorage = mStorage;
+    if( mSize != 0 )
+    {
+        memcpy( mValues + mCapacity, mValues, mSize );
+    }
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -99,8 +127,85 @@ LeddarCore::LdProperty::SetClean( void )
 void
 LeddarCore::LdProperty::SetCount( size_t aValue )
 {
-    mStorage.resize( aValue * mStride );
-    mBackupStorage.resize( mStorage.size() );
+    const size_t lSize = aValue * mStride;
+
+    if( lSize > mCapacity )
+    {
+        Reallocate( lSize, mArena );
+    }
+    else if( lSize > mSize )
+    {
+        // Room left by a previous shrink: the new values are zero, as with a new block
+        memset( mValues + mSize, 0, lSize - mSize );
+        memset( mValues + mCapacity + mSize, 0, lSize - mSize );
+    }
+
+    mSize = lSize;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LeddarCore::LdProperty::SetArena( const std::shared_ptr<LdPropertyArena> &aArena )
+///
+/// \brief  Move the values to the storage of a container (called by LdPropertiesContainer::AddProperty).
+///         The values stay there when the count changes, unless the property grows past its block.
+///
+/// \param  aArena  The arena of the container.
+///
+/// \author David Levy
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void
+LeddarCore::LdProperty::SetArena( const std::shared_ptr<LdPropertyArena> &aArena )
+{
+    if( aArena != mArena )
+    {
+        Reallocate( mSize, aArena );
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LeddarCore::LdProperty::Reallocate( size_t aCapacity, const std::shared_ptr<LdPropertyArena> &aArena )
+///
+/// \brief  Move the values and the backup values to a new block, zero past the current size.
+///
+/// \param  aCapacity   Minimum room for the values.
+/// \param  aArena      Arena to take the block from, on the heap if null.
+///
+/// \author David Levy
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void
+LeddarCore::LdProperty::Reallocate( size_t aCapacity, const std::shared_ptr<LdPropertyArena> &aArena )
+{
+    const size_t lCapacity = ( aCapacity + LdPropertyArena::ALIGNMENT - 1 ) & ~( LdPropertyArena::ALIGNMENT - 1 );
+    std::unique_ptr<uint8_t[]> lHeapStorage;
+    uint8_t *lValues = nullptr;
+
+    if( aArena )
+    {
+        lValues = aArena->Allocate( 2 * lCapacity );
+    }
+    else if( lCapacity != 0 )
+    {
+        lHeapStorage.reset( new uint8_t[2 * lCapacity]() );
+        lValues = lHeapStorage.get();
+    }
+
+    if( mSize != 0 )
+    {
+        memcpy( lValues, mValues, mSize );
+        memcpy( lValues + lCapacity, mValues + mCapacity, mSize );
+    }
+
+    if( mArena )
+    {
+        mArena->Release( 2 * mCapacity );
+    }
+
+    mValues = lValues;
+    mCapacity = lCapacity;
+    mHeapStorage.swap( lHeapStorage );
+    mArena = aArena;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -116,7 +221,7 @@ LeddarCore::LdProperty::Restore( void )
 {
     if( Modified() )
     {
-        mStorage = mBackupStorage;
+        memcpy( mValues, mValues + mCapacity, mSize );
         EmitSignal( LdObject::VALUE_CHANGED );
     }
 }
@@ -149,7 +254,7 @@ LeddarCore::LdProperty::SetRawStorage( uint8_t *aBuffer, size_t aCount, uint32_t
 
     if( aSize == mStride )
     {
-        memcpy( static_cast<uint8_t *>( &mStorage[0] ), aBuffer, aSize * aCount );
+        memcpy( mValues, aBuffer, aSize * aCount );
     }
     else
     {
@@ -186,19 +291,19 @@ LeddarCore::LdProperty::SetRawStorage( uint8_t *aBuffer, size_t aCount, uint32_t
 
             if( mStride == sizeof( uint8_t ) )
             {
-                static_cast<uint8_t *>( &mStorage[0] )[i] = static_cast<uint8_t>( lValue );
+                mValues[i] = static_cast<uint8_t>( lValue );
             }
             else if( mStride == sizeof( uint16_t ) )
             {
-                reinterpret_cast<uint16_t *>( &mStorage[0] )[i] = static_cast<uint16_t>( lValue );
+                reinterpret_cast<uint16_t *>( mValues )[i] = static_cast<uint16_t>( lValue );
             }
             else if( mStride == sizeof( uint32_t ) )
             {
-                reinterpret_cast<uint32_t *>( &mStorage[0] )[i] = static_cast<uint32_t>( lValue );
+                reinterpret_cast<uint32_t *>( mValues )[i] = static_cast<uint32_t>( lValue );
             }
             else if( mStride == sizeof( uint64_t ) )
             {
-                reinterpret_cast<uint64_t *>( &mStorage[0] )[i] = static_cast<uint64_t>( lValue );
+                reinterpret_cast<uint64_t *>( mValues )[i] = static_cast<uint64_t>( lValue );
             }
             else
             {
@@ -9,7 +9,9 @@
 #pragma once
 
 #include "LdObject.h"
+#include "LdPropertyArena.h"
 
+#include <memory>
 #include <string>
 #include <vector>
 #include <stdint.h>
@@ -61,7 +63,7 @@ namespace LeddarCore
         void Restore( void );
         void SetClean( void );
         void SetCount( size_t aValue );
-        size_t Count( void ) const { return mStorage.size() / mStride; }
+        size_t Count( void ) const { return mSize / mStride; }
         uint32_t UnitSize( void ) const { return mUnitSize; }
         ePropertyType GetType( void ) const { return mPropertyType; }
         uint32_t GetFeatures( void ) const { return mFeatures; }
@@ -76,22 +78,24 @@ namespace LeddarCore
 
         uint32_t GetId( void ) const { return mId;  }
         uint32_t GetDeviceId( void ) const { return mDeviceId; }
-        void     SetDeviceId( uint16_t aDeviceId ) { mDeviceId = aDeviceId; }
+        void     SetDeviceId( uint16_t aDeviceId );
         eCategories GetCategory( void ) const { return mCategory; }
         const std::string &GetDescription( void ) const { return mDescription; }
 
         virtual void SetRawStorage( uint8_t *aBuffer, size_t aCount, uint32_t aSize );
         virtual void ForceRawStorage( uint8_t *aBuffer, size_t aCount, uint32_t aSize );
-        const uint8_t *CStorage( void ) const { return &mStorage[ 0 ]; }
+        const uint8_t *CStorage( void ) const { return mValues; }
         int32_t RawValue( size_t aIndex = 0 ) const { return reinterpret_cast<const int32_t *>( CStorage() )[aIndex]; }
         virtual void SetRawValue( size_t aIndex, int32_t aValue );
 
+        void SetArena( const std::shared_ptr<LdPropertyArena> &aArena );
+
     protected:
         LdProperty( ePropertyType aPropertyType, eCategories aCategory, uint32_t aFeatures, uint32_t aId, uint32_t aDeviceId, uint32_t aUnitSize, size_t aStride,
                     const std::string &aDescription = "" );
 
-        uint8_t *Storage( void ) { return &mStorage[ 0 ]; }
-        const uint8_t *BackupStorage( void ) const { return &mBackupStorage[0]; }
+        uint8_t *Storage( void ) { return mValues; }
+        const uint8_t *BackupStorage( void ) const { return mValues + mCapacity; }
         bool IsInitialized( void ) const { return mInitialized; }
         void SetInitialized( bool aStatus ) { mInitialized = aStatus; }
         void VerifyInitialization( void ) const;
@@ -102,6 +106,8 @@ namespace LeddarCore
     private:
         LdProperty();
 
+        void Reallocate( size_t aCapacity, const std::shared_ptr<LdPropertyArena> &aArena );
+
         const eCategories   mCategory; ///< The id used by the device (which we do not control). 0 means that this property is not used in communication with the device.
         const uint32_t      mFeatures; ///< Features of the property.
         const uint32_t      mId;       ///< The id in files and also the generic id we control. See \ref LeddarCore::LdPropertyIds::eLdPropertyIds
@@ -113,7 +119,11 @@ namespace LeddarCore
         size_t              mStride;
         uint32_t            mUnitSize;
 
-        std::vector<uint8_t> mStorage, mBackupStorage;
+        uint8_t                             *mValues;       ///< Values, followed by the backup values at mValues + mCapacity
+        size_t                              mSize;          ///< Size of the values (and of the backup values) in bytes
+        size_t                              mCapacity;      ///< Room for the values (and for the backup values), multiple of LdPropertyArena::ALIGNMENT
+        std::unique_ptr<uint8_t[]>          mHeapStorage;   ///< Storage while the property is in no container
+        std::shared_ptr<LdPropertyArena>    mArena;         ///< Storage of the container the property was last added to
 
     };
 
@@ -0,0 +1,75 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \file   Leddar/LdPropertyArena.cpp
+///
+/// \brief  Implements the LdPropertyArena class
+///
+/// Copyright (c) 2026 LeddarTech. All rights reserved.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "LdPropertyArena.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace
+{
+    const size_t FIRST_CHUNK_SIZE = 512;
+    const size_t MAX_CHUNK_SIZE = 64 * 1024;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn LeddarCore::LdPropertyArena::LdPropertyArena( void )
+///
+/// \brief  Constructor. No memory is reserved until the first Allocate.
+///
+/// \author David Levy
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+LeddarCore::LdPropertyArena::LdPropertyArena( void ) :
+    mChunkSize( 0 ),
+    mChunkUsed( 0 ),
+    mAllocatedSize( 0 ),
+    mWastedSize( 0 )
+{
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn uint8_t *LeddarCore::LdPropertyArena::Allocate( size_t aSize )
+///
+/// \brief  Get a zeroed block, aligned on ALIGNMENT bytes.
+///         The chunks double in size (up to MAX_CHUNK_SIZE) so a small container does not reserve much.
+///
+/// \param  aSize   Size of the block in bytes.
+///
+/// \return Pointer to the block, nullptr if aSize is 0.
+///
+/// \author David Levy
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+uint8_t *
+LeddarCore::LdPropertyArena::Allocate( size_t aSize )
+{
+    if( aSize == 0 )
+    {
+        return nullptr;
+    }
+
+    aSize = ( aSize + ALIGNMENT - 1 ) & ~( ALIGNMENT - 1 );
+
+    if( mChunks.empty() || mChunkSize - mChunkUsed < aSize )
+    {
+        size_t lChunkSize = mChunks.empty() ? FIRST_CHUNK_SIZE : std::min( mChunkSize * 2, MAX_CHUNK_SIZE );
+        lChunkSize = std::max( lChunkSize, aSize );
+
+        // new[] is aligned for any fundamental type
+        mChunks.push_back( std::unique_ptr< uint8_t[] >( new uint8_t[lChunkSize] ) );
+        memset( mChunks.back().get(), 0, lChunkSize );
+        mChunkSize = lChunkSize;
+        mChunkUsed = 0;
+    }
+
+    uint8_t *lBlock = mChunks.back().get() + mChunkUsed;
+    mChunkUsed += aSize;
+    mAllocatedSize += aSize;
+    return lBlock;
+}
@@ -0,0 +1,54 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \file   Leddar/LdPropertyArena.h
+///
+/// \brief  Declares the LdPropertyArena class.
+///     Storage shared by the properties of a container (see LdPropertiesContainer::AddProperty).
+///
+/// Copyright (c) 2026 LeddarTech. All rights reserved.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <memory>
+#include <stdint.h>
+#include <vector>
+
+namespace LeddarCore
+{
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \class  LdPropertyArena
+    ///
+    /// \brief  Bump allocator for the values of the properties of a container.
+    ///
+    ///         Memory is taken from chunks that never move, so the pointers stay valid for the life of the arena.
+    ///         Nothing is freed individually: a property that grows gets a new block and the previous one is lost
+    ///         until the arena is destroyed (WastedSize). The properties hold a shared pointer to their arena, so it
+    ///         lives as long as any of them. Not thread safe, like the properties themselves.
+    ///
+    /// \author David Levy
+    /// \date   October 2026
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    class LdPropertyArena
+    {
+    public:
+        static const size_t ALIGNMENT = 8;
+
+        LdPropertyArena( void );
+
+        uint8_t *Allocate( size_t aSize );
+        void     Release( size_t aSize ) { mWastedSize += aSize; }
+
+        size_t   AllocatedSize( void ) const { return mAllocatedSize; }
+        size_t   WastedSize( void ) const { return mWastedSize; }
+
+    private:
+        LdPropertyArena( const LdPropertyArena &aArena ); //Disable copy constructor
+        LdPropertyArena &operator=( const LdPropertyArena &aArena ); //Disable equal operator
+
+        std::vector< std::unique_ptr< uint8_t[] > > mChunks;
+        size_t  mChunkSize;     ///< Size of the last chunk
+        size_t  mChunkUsed;     ///< Bytes used in the last chunk
+        size_t  mAllocatedSize; ///< Bytes handed out
+        size_t  mWastedSize;    ///< Bytes handed out then released
+    };
+}
@@ -26,7 +26,8 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 LeddarConnection::LdProtocolCan::LdProtocolCan( const LdConnectionInfo *aConnectionInfo, LdConnection *aInterface, bool aIsM16 ) : LdConnection( aConnectionInfo, aInterface ),
     mIsM16( aIsM16 ),
-    mIsStreaming( false )
+    mIsStreaming( false ),
+    mDetectionTimestamp( 0 )
 {
     mInterfaceCAN = dynamic_cast<LeddarConnection::LdInterfaceCan *>( aInterface );
     mInterfaceCAN->ConnectSignal( this, LeddarCore::LdObject::NEW_DATA );
@@ -164,6 +165,8 @@ LtComCanBus::sCanData LeddarConnection::LdProtocolCan::GetNextDetectionData()
     {
         LtComCanBus::sCanData lNextData = mBufferDetections.front();
         mBufferDetections.pop();
+        mDetectionTimestamp = mDetectionTimestamps.front();
+        mDetectionTimestamps.pop();
         return lNextData;
     }
     else
@@ -320,6 +323,7 @@ void LeddarConnection::LdProtocolCan::Callback( LdObject *aSender, const SIGNALS
             else
             {
                 mBufferDetections.push( lCanData );
+                mDetectionTimestamps.push( mInterfaceCAN->GetReceiveTimestamp() );
             }
         }
         else //Vu8
@@ -333,6 +337,7 @@ void LeddarConnection::LdProtocolCan::Callback( LdObject *aSender, const SIGNALS
             else
             {
                 mBufferDetections.push( lCanData );
+                mDetectionTimestamps.push( mInterfaceCAN->GetReceiveTimestamp() );
             }
         }
 
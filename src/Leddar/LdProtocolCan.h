@@ -36,8 +36,10 @@ namespace LeddarConnection
         bool        SendRequestAndWaitForAnswer( const LtComCanBus::sCanData &aData );
         bool        ReadConfigAnswer( void );
         bool        ReadDetectionAnswer( void );
+        bool        WaitForData( uint32_t aTimeoutMs ) { return mInterfaceCAN->WaitForData( aTimeoutMs ); } ///Wait for the receive thread, or sleep if it is not running
         LtComCanBus::sCanData GetNextConfigData();
         LtComCanBus::sCanData GetNextDetectionData();
+        uint64_t    GetDetectionTimestamp( void ) const { return mDetectionTimestamp; } ///Host monotonic time (ns) the last frame returned by GetNextDetectionData was received
 
         LtComCanBus::sCanData   GetValue( uint8_t aCommandId, uint8_t aCommandArg );
         void                    SetValue( const LtComCanBus::sCanData &aCommand );
@@ -55,6 +57,8 @@ namespace LeddarConnection
         bool mIsM16;                                            ///Currently the only difference between M16 et Vu8 CAN protocol is how the buffer are handled.
         ///     Might need to create a child class to properly handle the differences if there is more
         bool mIsStreaming;
+        std::queue<uint64_t> mDetectionTimestamps;              ///Reception time of each frame of mBufferDetections
+        uint64_t mDetectionTimestamp;
 
         virtual void    Callback( LdObject *aSender, const SIGNALS aSignal, void *aCanData ) override;
     };
@@ -45,7 +45,7 @@ LdProtocolLeddarTech::LdProtocolLeddarTech( const LdConnectionInfo *aConnectionI
     mElementSize( 0 ),
     mElementValueOffset( 0 )
 {
-    mTransferBufferSize = 19000;
+    mTransferBufferSize = MAX_REQUEST_SIZE;
     mTransferInputBuffer = new uint8_t[mTransferBufferSize];
     mTransferOutputBuffer = new uint8_t[mTransferBufferSize];
 }
@@ -178,6 +178,7 @@ void
 LdProtocolLeddarTech::ReadRequest()
 {
     VerifyConnection();
+    LT_TIMING_BEGIN( lStart );
 
     // Read the header
     Read( sizeof( LtComLeddarTechPublic::sLtCommRequestHeader ) );
@@ -186,6 +187,9 @@ LdProtocolLeddarTech::ReadRequest()
     mRequestCode = lRequestHeader->mRequestCode;
     mMessageSize = lRequestHeader->mRequestTotalSize - sizeof( LtComLeddarTechPublic::sLtCommRequestHeader );
     mElementOffset = sizeof( LtComLeddarTechPublic::sLtCommRequestHeader );
+    ++mCounters->mTransactions;
+    mCounters->mBytesIn += lRequestHeader->mRequestTotalSize;
+    LT_TIMING_END( mTimingStats, TS_TRANSPORT_READ, lStart );
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -204,6 +208,8 @@ LdProtocolLeddarTech::SendRequest( void )
     VerifyConnection();
 
     Write( static_cast<uint32_t>( mMessageSize ) );
+    ++mCounters->mTransactions;
+    mCounters->mBytesOut += mMessageSize;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -326,6 +332,73 @@ LdProtocolLeddarTech::AddElement( uint16_t aId, uint16_t aCount, uint32_t aSize,
     *mTotalMessageSize += lAddedSize;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LdProtocolLeddarTech::SendProperties( uint16_t aRequestCode, const std::vector<LeddarCore::LdProperty *> &aProperties, unsigned int aRetryNbr )
+///
+/// \brief  Send the values of properties, as many per request as fit in MAX_REQUEST_SIZE.
+///         Nothing is sent if aProperties is empty. All the requests are sent even if one is refused: GetAnswerCode returns
+///         the first answer code that is not LT_COMM_ANSWER_OK, if any.
+///
+/// \exception  LtComException  see VerifyConnection, and the errors of ReadAnswer left after aRetryNbr retries.
+///
+/// \param  aRequestCode    Request code (LT_COMM_CFGSRV_REQUEST_SET, LT_COMM_CFGSRV_REQUEST_SET_CONFIG...).
+/// \param  aProperties     Properties to send, with their device id.
+/// \param  aRetryNbr       Number of times to read the answer again when it is not valid.
+///
+/// \author David Levy
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void
+LdProtocolLeddarTech::SendProperties( uint16_t aRequestCode, const std::vector<LeddarCore::LdProperty *> &aProperties, unsigned int aRetryNbr )
+{
+    uint16_t lAnswerCode = LtComLeddarTechPublic::LT_COMM_ANSWER_OK;
+    size_t lNext = 0;
+
+    while( lNext < aProperties.size() )
+    {
+        StartRequest( aRequestCode );
+
+        // At least one element per request, a property larger than MAX_REQUEST_SIZE grows the buffers as before
+        do
+        {
+            LeddarCore::LdProperty *lProperty = aProperties[lNext++];
+            AddElement( static_cast<uint16_t>( lProperty->GetDeviceId() ), static_cast<uint16_t>( lProperty->Count() ), lProperty->UnitSize(), lProperty->CStorage(),
+                        static_cast<uint32_t>( lProperty->Stride() ) );
+        }
+        while( lNext < aProperties.size() &&
+                mMessageSize + sizeof( LtComLeddarTechPublic::sLtCommElementHeader ) + aProperties[lNext]->Count() * aProperties[lNext]->UnitSize() <= MAX_REQUEST_SIZE );
+
+        SendRequest();
+
+        unsigned int lCount = aRetryNbr;
+        bool lRetry = false;
+
+        do
+        {
+            try
+            {
+                lRetry = false;
+                ReadAnswer();
+            }
+            catch( LeddarException::LtComException &e )
+            {
+                if( e.GetDisconnect() == true )
+                    throw;
+
+                ( lCount-- != 0 ) ? lRetry = true : throw;
+            }
+        }
+        while( lRetry );
+
+        if( lAnswerCode == LtComLeddarTechPublic::LT_COMM_ANSWER_OK )
+        {
+            lAnswerCode = mAnswerCode;
+        }
+    }
+
+    mAnswerCode = lAnswerCode;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// \fn bool LdProtocolLeddarTech::ReadElement( void )
 ///
@@ -379,6 +452,48 @@ LdProtocolLeddarTech::GetElementData( void ) const
     return mTransferOutputBuffer + mElementValueOffset;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn LdElementView LdProtocolLeddarTech::GetElementView( void ) const
+///
+/// \brief  Return a view over the values of the current element, without copying them
+///
+/// \return The view, valid until the next message is read.
+///
+/// \author David Levy
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+LdElementView
+LdProtocolLeddarTech::GetElementView( void ) const
+{
+    return LdElementView( mElementId, mElementCount, mElementSize, mTransferOutputBuffer + mElementValueOffset );
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn bool LdProtocolLeddarTech::ReadElementView( LdElementView &aView )
+///
+/// \brief  Read the next element and return a view over its values
+///
+/// \exception  LtComException  see VerifyConnection.
+///
+/// \param [out]    aView   View over the element, valid until the next message is read.
+///
+/// \return False if there is no more element in the message.
+///
+/// \author David Levy
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool
+LdProtocolLeddarTech::ReadElementView( LdElementView &aView )
+{
+    if( !ReadElement() )
+    {
+        return false;
+    }
+
+    aView = GetElementView();
+    return true;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// \fn bool LdProtocolLeddarTech::ReadElementToProperty( LeddarCore::LdPropertiesContainer *aProperties )
 ///
@@ -459,21 +574,38 @@ LdProtocolLeddarTech::PushElementDataToBuffer( void *aDest, uint16_t aCount, uin
         throw LeddarException::LtComException( "Unable to push the element in the buffer, count or size do not match." );
     }
 
-    if( aStride == mElementSize )
+    GetElementView().CopyTo( aDest, aStride );
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LdElementView::CopyTo( void *aDest, size_t aStride ) const
+///
+/// \brief  Copies the values to the destination, one block if the values are contiguous in the destination.
+///
+/// \param [in,out] aDest   Destination of the first value.
+/// \param          aStride Spacing in bytes between each value in the destination.
+///
+/// \author David Levy
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void
+LdElementView::CopyTo( void *aDest, size_t aStride ) const
+{
+    if( aStride == mSize )
     {
-        memcpy( aDest, GetElementData(),
-                mElementCount * mElementSize );
+        memcpy( aDest, mData,
+                mCount * mSize );
     }
     else
     {
-        switch( mElementSize )
+        switch( mSize )
         {
             case 1:
             {
-                const uint8_t *const lSrc = static_cast<const uint8_t *>( GetElementData() );
+                const uint8_t *const lSrc = mData;
                 uint8_t *lDest = static_cast<uint8_t *>( aDest );
 
-                for( uint16_t i = 0; i < mElementCount; ++i )
+                for( uint16_t i = 0; i < mCount; ++i )
                 {
                     *lDest = lSrc[i];
                     lDest += aStride;
@@ -483,10 +615,10 @@ LdProtocolLeddarTech::PushElementDataToBuffer( void *aDest, uint16_t aCount, uin
 
             case 2:
             {
-                const uint16_t *const lSrc = reinterpret_cast<const uint16_t *>( GetElementData() );
+                const uint16_t *const lSrc = reinterpret_cast<const uint16_t *>( mData );
                 uint16_t *lDest = reinterpret_cast<uint16_t *>( aDest );
 
-                for( uint16_t i = 0; i < mElementCount; ++i )
+                for( uint16_t i = 0; i < mCount; ++i )
                 {
                     *lDest = lSrc[i];
                     lDest = reinterpret_cast<uint16_t *>( reinterpret_cast<uint8_t *>( lDest ) + aStride );
@@ -496,10 +628,10 @@ LdProtocolLeddarTech::PushElementDataToBuffer( void *aDest, uint16_t aCount, uin
 
             case 4:
             {
-                const uint32_t *const lSrc = reinterpret_cast<const uint32_t *>( GetElementData() );
+                const uint32_t *const lSrc = reinterpret_cast<const uint32_t *>( mData );
                 uint32_t *lDest = reinterpret_cast<uint32_t *>( aDest );
 
-                for( uint16_t i = 0; i < mElementCount; ++i )
+                for( uint16_t i = 0; i < mCount; ++i )
                 {
                     *lDest = lSrc[i];
                     lDest = reinterpret_cast<uint32_t *>( reinterpret_cast<uint8_t *>( lDest ) + aStride );
@@ -509,10 +641,10 @@ LdProtocolLeddarTech::PushElementDataToBuffer( void *aDest, uint16_t aCount, uin
 
             case 8:
             {
-                const uint64_t *const lSrc = reinterpret_cast<const uint64_t *>( GetElementData() );
+                const uint64_t *const lSrc = reinterpret_cast<const uint64_t *>( mData );
                 uint64_t *lDest = reinterpret_cast<uint64_t *>( aDest );
 
-                for( uint16_t i = 0; i < mElementCount; ++i )
+                for( uint16_t i = 0; i < mCount; ++i )
                 {
                     *lDest = lSrc[i];
                     lDest = reinterpret_cast<uint64_t *>( reinterpret_cast<uint8_t *>( lDest ) + aStride );
@@ -522,16 +654,16 @@ LdProtocolLeddarTech::PushElementDataToBuffer( void *aDest, uint16_t aCount, uin
 
             default:
             {
-                const uint8_t *const lSrc = static_cast<const uint8_t *>( GetElementData() );
+                const uint8_t *const lSrc = mData;
                 uint8_t *lDest = static_cast<uint8_t *>( aDest );
 
-                for( uint16_t i = 0; i < mElementCount; ++i )
+                for( uint16_t i = 0; i < mCount; ++i )
                 {
-                    memcpy( lDest, lSrc + i * mElementSize, mElementSize );
+                    memcpy( lDest, lSrc + i * mSize, mSize );
                     lDest += aStride;
                 }
             }
             break;
         }
     }
-}
\ No newline at end of file
+}
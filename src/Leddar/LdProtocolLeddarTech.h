@@ -17,11 +17,62 @@
 #include "LdConnection.h"
 #include "LdPropertiesContainer.h"
 
+#include <cassert>
+#include <cstring>
+#include <type_traits>
+
 namespace LeddarConnection
 {
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \struct LdElementView
+    ///
+    /// \brief  View over the values of an element still in the receive buffer (see LdProtocolLeddarTech::GetElementView).
+    ///         Valid until the next message is read on the protocol.
+    ///         Values are packed (stride = size) and may be unaligned: use As only when it is not null, else At or CopyTo.
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    struct LdElementView
+    {
+        LdElementView() : mId( 0 ), mCount( 0 ), mSize( 0 ), mData( nullptr ) {}
+        LdElementView( uint16_t aId, uint16_t aCount, uint32_t aSize, const uint8_t *aData ) : mId( aId ), mCount( aCount ), mSize( aSize ), mData( aData ) {}
+
+        uint16_t        Id( void ) const { return mId; }
+        uint16_t        Count( void ) const { return mCount; }
+        uint32_t        Size( void ) const { return mSize; }
+        size_t          Bytes( void ) const { return static_cast<size_t>( mCount ) * mSize; }
+        const uint8_t  *Data( void ) const { return mData; }
+
+        /// \brief  Typed pointer on the values, null if the size of T does not match or the data is not aligned for T.
+        template<typename T> const T *As( void ) const
+        {
+            if( sizeof( T ) != mSize || reinterpret_cast<uintptr_t>( mData ) % std::alignment_of<T>::value != 0 )
+                return nullptr;
+
+            return reinterpret_cast<const T *>( mData );
+        }
+
+        /// \brief  Value at aIndex, safe on unaligned data.
+        template<typename T> T At( size_t aIndex ) const
+        {
+            assert( sizeof( T ) == mSize && aIndex < mCount );
+            T lValue;
+            memcpy( &lValue, mData + aIndex * mSize, sizeof( T ) );
+            return lValue;
+        }
+
+        void CopyTo( void *aDest, size_t aStride ) const;
+
+    private:
+        uint16_t        mId;
+        uint16_t        mCount;
+        uint32_t        mSize;
+        const uint8_t  *mData;
+    };
+
     class LdProtocolLeddarTech : public LdConnection
     {
     public:
+        static const uint32_t MAX_REQUEST_SIZE = 19000; ///< Size of the transfer buffers, and of the largest request SendProperties sends
+
         struct LdEcho
         {
             int32_t  mDistance;
@@ -61,10 +112,13 @@ namespace LeddarConnection
         virtual sIdentifyInfo   GetInfo( void ) { return mIdentityInfo; }
         virtual uint32_t        GetMessageSize( void ) { return static_cast<uint32_t>( mMessageSize ); }
         virtual void            AddElement( uint16_t aId, uint16_t aCount, uint32_t aSize, const void *aData, uint32_t aStride );
+        void                    SendProperties( uint16_t aRequestCode, const std::vector<LeddarCore::LdProperty *> &aProperties, unsigned int aRetryNbr = 0 );
         virtual bool            ReadElement( void );
         virtual void            ReadElementToProperties( LeddarCore::LdPropertiesContainer *aProperties );
         virtual void            PushElementDataToBuffer( void *aDest, uint16_t aCount, uint32_t aSize, size_t aStride );
         virtual void           *GetElementData( void ) const;
+        LdElementView           GetElementView( void ) const;
+        bool                    ReadElementView( LdElementView &aView );
         virtual uint16_t        GetElementId( void ) const { return mElementId; }
         virtual uint16_t        GetElementCount( void ) const { return mElementCount; }
         virtual uint32_t        GetElementSize( void ) const { return mElementSize; }
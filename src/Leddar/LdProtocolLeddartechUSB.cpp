@@ -101,6 +101,32 @@ void LdProtocolLeddartechUSB::Read( uint32_t /*aSize*/ )
     mInterfaceUSB->Read( mEndPoint, mTransferOutputBuffer, mTransferBufferSize );
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LdProtocolLeddartechUSB::SetAsyncRead( bool aEnable, size_t aTransferCount )
+///
+/// \brief  Keeps aTransferCount transfers queued on the endpoint of this protocol (see LdInterfaceUsb::StartAsyncRead).
+///         Only for endpoints the host does not write to, like the data endpoint.
+///
+/// \param  aEnable         True to start, false to stop.
+/// \param  aTransferCount  Number of queued transfers.
+///
+/// \author David Levy
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void
+LdProtocolLeddartechUSB::SetAsyncRead( bool aEnable, size_t aTransferCount )
+{
+    if( aEnable )
+    {
+        VerifyConnection();
+        mInterfaceUSB->StartAsyncRead( mEndPoint, mTransferBufferSize, aTransferCount );
+    }
+    else
+    {
+        mInterfaceUSB->StopAsyncRead();
+    }
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// \fn void LdProtocolLeddartechUSB::QueryDeviceInfo( void )
 ///
@@ -155,6 +181,7 @@ LdProtocolLeddartechUSB::ReadAnswer( void )
 
     mAnswerCode = lHeader->mAnswerCode;
     mMessageSize = lHeader->mAnswerSize - sizeof( LtComUSBPublic::sLtCommAnswerHeader );
+    mCounters->mBytesIn += lHeader->mAnswerSize;
     mElementOffset = sizeof( LtComUSBPublic::sLtCommAnswerHeader );
 }
 
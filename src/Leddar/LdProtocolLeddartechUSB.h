@@ -39,6 +39,7 @@ namespace LeddarConnection
 
         virtual void QueryDeviceInfo( void ) override;
         virtual void ReadAnswer( void ) override;
+        void         SetAsyncRead( bool aEnable, size_t aTransferCount = 4 );
 
     protected:
         virtual void Write( uint32_t aSize ) override;
@@ -11,13 +11,44 @@
 #include "LtMathUtils.h"
 #include "LdPropertyIds.h"
 
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
 #ifdef _DEBUG
 #include <sstream>
 #endif
 using namespace LeddarConnection;
 
+namespace
+{
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn LdEcho ReadEcho( const EchoBuffer &aBuffer, size_t aIndex )
+    ///
+    /// \brief  Reads an echo from a frame buffer, from the columns if the producer wrote them directly
+    ///
+    /// \author David Levy
+    /// \date   October 2026
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    LdEcho ReadEcho( const EchoBuffer &aBuffer, size_t aIndex )
+    {
+        if( !aBuffer.mColumnsWritten )
+        {
+            return aBuffer.mEchoes[aIndex];
+        }
+
+        LdEcho lEcho;
+        lEcho.mDistance = aBuffer.mColumns.mDistances[aIndex];
+        lEcho.mAmplitude = aBuffer.mColumns.mAmplitudes[aIndex];
+        lEcho.mBase = aBuffer.mColumns.mBases[aIndex];
+        lEcho.mChannelIndex = aBuffer.mColumns.mChannelIndexes[aIndex];
+        lEcho.mFlag = aBuffer.mColumns.mFlags[aIndex];
+        return lEcho;
+    }
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
-/// \fn LdResultEchoes::LdResultEchoes( void ) : mIsInitialized( false ), mDistanceScale( 0 ), mAmplitudeScale( 0 ), mCurrentLedPower( LeddarCore::LdProperty::CAT_INFO, LeddarCore::LdProperty::F_SAVE, LeddarCore::LdPropertyIds::ID_CURRENT_LED_INTENSITY, 0, sizeof( uint16_t ), "Current led power", false )
+/// \fn LdResultEchoes::LdResultEchoes( void )
 ///
 /// \brief  Constructor.
 ///
@@ -26,16 +57,14 @@ using namespace LeddarConnection;
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 LdResultEchoes::LdResultEchoes( void ) :
     mIsInitialized( false ),
+    mColumnLayout( false ),
     mDistanceScale( 0 ),
     mAmplitudeScale( 0 ),
     mHFOV( 0 ),
     mVFOV( 0 ),
     mHChan( 0 ),
-    mVChan( 0 ),
-    mCurrentLedPower( LeddarCore::LdProperty::CAT_INFO, LeddarCore::LdProperty::F_SAVE, LeddarCore::LdPropertyIds::ID_CURRENT_LED_INTENSITY, 0, sizeof( uint16_t ), "Current led power",
-                      false )
+    mVChan( 0 )
 {
-    mCurrentLedPower.ForceValue( 0, 0 );
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -51,19 +80,20 @@ LdResultEchoes::~LdResultEchoes()
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
-/// \fn void LdResultEchoes::Init( uint32_t aDistanceScale, uint32_t aAmplitudeScale, uint32_t aMaxDetections )
+/// \fn void LdResultEchoes::Init( uint32_t aDistanceScale, uint32_t aAmplitudeScale, uint32_t aMaxDetections, uint32_t aFrameCount )
 ///
 /// \brief  Initialize the result object. This function need to be called before use.
 ///
 /// \param  aDistanceScale  The distance scale.
 /// \param  aAmplitudeScale The amplitude scale.
 /// \param  aMaxDetections  The maximum detections.
+/// \param  aFrameCount     Number of frame buffers in the ring (at least 2). Each frame held by a consumer needs one more buffer.
 ///
 /// \author Patrick Boulay
 /// \date   March 2016
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 void
-LdResultEchoes::Init( uint32_t aDistanceScale, uint32_t aAmplitudeScale, uint32_t aMaxDetections )
+LdResultEchoes::Init( uint32_t aDistanceScale, uint32_t aAmplitudeScale, uint32_t aMaxDetections, uint32_t aFrameCount )
 {
     if( !mIsInitialized )
     {
@@ -73,14 +103,24 @@ LdResultEchoes::Init( uint32_t aDistanceScale, uint32_t aAmplitudeScale, uint32_
             assert( 0 );
         }
 
-        mEchoBuffer1.mEchoes.resize( aMaxDetections );
-        mEchoBuffer2.mEchoes.resize( aMaxDetections );
+        mEchoBuffers.resize( aFrameCount );
+        std::vector<void *> lBuffers( aFrameCount );
+
+        for( size_t i = 0; i < mEchoBuffers.size(); ++i )
+        {
+            mEchoBuffers[i].mEchoes.resize( aMaxDetections );
+            lBuffers[i] = &mEchoBuffers[i];
+
+            if( mColumnLayout )
+            {
+                AllocateColumns( mEchoBuffers[i] );
+            }
+        }
 
-        mDoubleBuffer.Init( &mEchoBuffer1, &mEchoBuffer2, LdResultProvider::mTimestamp );
+        mRingBuffer.Init( lBuffers, LdResultProvider::mTimestamp );
 
         mDistanceScale = aDistanceScale;
         mAmplitudeScale = aAmplitudeScale;
-        mCurrentLedPower.SetCount( 2 );
 
         mIsInitialized = true;
     }
@@ -89,7 +129,7 @@ LdResultEchoes::Init( uint32_t aDistanceScale, uint32_t aAmplitudeScale, uint32_
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// \fn void LeddarConnection::LdResultEchoes::Swap()
 ///
-/// \brief  Swap the two data buffer
+/// \brief  Publish the set buffer as the latest frame and start writing in a free buffer
 ///
 /// \author David Levy
 /// \date   May 2018
@@ -97,14 +137,199 @@ LdResultEchoes::Init( uint32_t aDistanceScale, uint32_t aAmplitudeScale, uint32_
 void
 LeddarConnection::LdResultEchoes::Swap()
 {
-    if( mCurrentLedPower.Count() == 2 )
+    LT_TIMING_BEGIN( lStart );
+    EchoBuffer *lSetBuffer = static_cast< EchoBuffer * >( mRingBuffer.GetBuffer( B_SET )->mBuffer );
+
+    if( mColumnLayout && !lSetBuffer->mColumnsWritten )
+    {
+        FillColumns( *lSetBuffer );
+    }
+
+    mRingBuffer.Swap();
+    EchoBuffer *lNewSetBuffer = static_cast< EchoBuffer * >( mRingBuffer.GetBuffer( B_SET )->mBuffer );
+    lNewSetBuffer->mColumnsWritten = false;
+    lNewSetBuffer->mHostTimestamp = 0;
+    mHostTimestampSet = false;
+    LT_TIMING_END( mTimingStats, TS_SWAP, lStart );
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LeddarConnection::LdResultEchoes::SetTimestamp( uint32_t aTimestamp )
+///
+/// \brief  Set the sensor timestamp of the frame being written.
+///         Also takes its host timestamp, unless the sensor already set it after its read (SetHostTimestamp).
+///
+/// \param  aTimestamp  Sensor timestamp.
+///
+/// \author David Levy
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void
+LeddarConnection::LdResultEchoes::SetTimestamp( uint32_t aTimestamp )
+{
+    mRingBuffer.SetTimestamp( aTimestamp );
+
+    if( !mHostTimestampSet )
+    {
+        static_cast< EchoBuffer * >( mRingBuffer.GetBuffer( B_SET )->mBuffer )->mHostTimestamp = LeddarUtils::LtTimeUtils::GetMonotonicNanoseconds();
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LeddarConnection::LdResultEchoes::SetHostTimestamp( uint64_t aHostTimestamp )
+///
+/// \brief  Set the host timestamp of the frame being written. Called by the sensors right after the transport read.
+///
+/// \param  aHostTimestamp  Host monotonic time in nanoseconds (LtTimeUtils::GetMonotonicNanoseconds).
+///
+/// \author David Levy
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void
+LeddarConnection::LdResultEchoes::SetHostTimestamp( uint64_t aHostTimestamp )
+{
+    static_cast< EchoBuffer * >( mRingBuffer.GetBuffer( B_SET )->mBuffer )->mHostTimestamp = aHostTimestamp;
+    mHostTimestampSet = true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn uint64_t LeddarConnection::LdResultEchoes::GetAcquisitionDelay( eBuffer aBuffer ) const
+///
+/// \brief  Time elapsed since the host received the frame.
+///
+/// \param  aBuffer The buffer (get or set).
+///
+/// \return Delay in nanoseconds, 0 if the frame has no host timestamp.
+///
+/// \author David Levy
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+uint64_t
+LeddarConnection::LdResultEchoes::GetAcquisitionDelay( eBuffer aBuffer ) const
+{
+    uint64_t lHostTimestamp = GetHostTimestamp( aBuffer );
+
+    if( lHostTimestamp == 0 )
     {
-        int64_t lOldLedPower = mCurrentLedPower.Value( 0 );
-        mCurrentLedPower.ForceValue( 0, mCurrentLedPower.Value( 1 ) );
-        mCurrentLedPower.ForceValue( 1, lOldLedPower );
+        return 0;
     }
 
-    mDoubleBuffer.Swap();
+    return LeddarUtils::LtTimeUtils::GetMonotonicNanoseconds() - lHostTimestamp;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LeddarConnection::LdResultEchoes::SetColumnLayout( bool aEnable )
+///
+/// \brief  Enable or disable the column (structure of arrays) layout. Must be called before the acquisition starts.
+///
+///         With the column layout, every frame holds one contiguous array per echo field (see GetDistances, GetAmplitudes...).
+///         Sensors that support it write the columns directly (see GetColumns), and their echoes vector (GetEchoes) is not filled.
+///         For the other sensors, the columns are filled from the echoes vector when the buffers are swapped.
+///         GetEcho and the GetEchoXxx( index ) accessors work with both layouts.
+///
+/// \param  aEnable True to enable the column layout.
+///
+/// \author David Levy
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void
+LeddarConnection::LdResultEchoes::SetColumnLayout( bool aEnable )
+{
+    mColumnLayout = aEnable;
+
+    for( size_t i = 0; i < mEchoBuffers.size(); ++i )
+    {
+        if( aEnable )
+        {
+            AllocateColumns( mEchoBuffers[i] );
+        }
+        else
+        {
+            mEchoBuffers[i].mColumns = EchoColumns();
+            mEchoBuffers[i].mColumnsWritten = false;
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn LeddarConnection::EchoColumns *LeddarConnection::LdResultEchoes::GetColumns( eBuffer aBuffer )
+///
+/// \brief  Gets the columns of a buffer, so the protocol can copy whole elements in them.
+///         Requesting the set buffer columns marks the frame as written in columns (its echoes vector will not be filled).
+///
+/// \exception  std::logic_error    Thrown when the column layout is not enabled.
+///
+/// \param  aBuffer The buffer.
+///
+/// \return The columns, each one is sized to the maximum number of detections.
+///
+/// \author David Levy
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+LeddarConnection::EchoColumns *
+LeddarConnection::LdResultEchoes::GetColumns( eBuffer aBuffer )
+{
+    if( !mColumnLayout )
+    {
+        throw std::logic_error( "Column layout is not enabled" );
+    }
+
+    EchoBuffer *lBuffer = static_cast< EchoBuffer * >( mRingBuffer.GetBuffer( aBuffer )->mBuffer );
+
+    if( aBuffer == B_SET )
+    {
+        lBuffer->mColumnsWritten = true;
+    }
+
+    return &lBuffer->mColumns;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LeddarConnection::LdResultEchoes::AllocateColumns( EchoBuffer &aBuffer ) const
+///
+/// \brief  Allocate the columns of a frame buffer to the maximum number of detections
+///
+/// \param [in,out] aBuffer The frame buffer.
+///
+/// \author David Levy
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void
+LeddarConnection::LdResultEchoes::AllocateColumns( EchoBuffer &aBuffer ) const
+{
+    size_t lSize = aBuffer.mEchoes.size();
+    aBuffer.mColumns.mDistances.resize( lSize );
+    aBuffer.mColumns.mAmplitudes.resize( lSize );
+    aBuffer.mColumns.mBases.resize( lSize );
+    aBuffer.mColumns.mChannelIndexes.resize( lSize );
+    aBuffer.mColumns.mFlags.resize( lSize );
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LeddarConnection::LdResultEchoes::FillColumns( EchoBuffer &aBuffer ) const
+///
+/// \brief  Fill the columns of a frame buffer from its echoes vector
+///
+/// \param [in,out] aBuffer The frame buffer.
+///
+/// \author David Levy
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void
+LeddarConnection::LdResultEchoes::FillColumns( EchoBuffer &aBuffer ) const
+{
+    const LdEcho *lEchoes = aBuffer.mEchoes.data();
+    EchoColumns &lColumns = aBuffer.mColumns;
+    size_t lCount = std::min<size_t>( aBuffer.mCount, aBuffer.mEchoes.size() );
+
+    for( size_t i = 0; i < lCount; ++i )
+    {
+        lColumns.mDistances[i] = lEchoes[i].mDistance;
+        lColumns.mAmplitudes[i] = lEchoes[i].mAmplitude;
+        lColumns.mBases[i] = lEchoes[i].mBase;
+        lColumns.mChannelIndexes[i] = lEchoes[i].mChannelIndex;
+        lColumns.mFlags[i] = lEchoes[i].mFlag;
+    }
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -127,13 +352,13 @@ LdResultEchoes::GetEchoCount( eBuffer aBuffer ) const
         assert( 0 );
     }
 
-    return static_cast< const EchoBuffer * >( mDoubleBuffer.GetConstBuffer( aBuffer )->mBuffer )->mCount;
+    return static_cast< const EchoBuffer * >( mRingBuffer.GetConstBuffer( aBuffer )->mBuffer )->mCount;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// \fn std::vector<LdEcho> * LdResultEchoes::GetEchoes( eBuffer aBuffer )
 ///
-/// \brief  Get echoes vector
+/// \brief  Get echoes vector. With the column layout, it is not filled for frames written in columns (see SetColumnLayout).
 ///
 /// \param  aBuffer The buffer.
 ///
@@ -150,7 +375,31 @@ LdResultEchoes::GetEchoes( eBuffer aBuffer )
         assert( 0 );
     }
 
-    return &static_cast< EchoBuffer * >( mDoubleBuffer.GetBuffer( aBuffer )->mBuffer )->mEchoes;
+    return &static_cast< EchoBuffer * >( mRingBuffer.GetBuffer( aBuffer )->mBuffer )->mEchoes;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn LeddarConnection::LdEcho LeddarConnection::LdResultEchoes::GetEcho( size_t aIndex, eBuffer aBuffer ) const
+///
+/// \brief  Gets an echo, whatever the layout of the buffer
+///
+/// \param  aIndex  Echo index.
+/// \param  aBuffer The buffer.
+///
+/// \return The echo.
+///
+/// \author David Levy
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+LeddarConnection::LdEcho
+LeddarConnection::LdResultEchoes::GetEcho( size_t aIndex, eBuffer aBuffer ) const
+{
+    if( !mIsInitialized )
+    {
+        assert( 0 );
+    }
+
+    return ReadEcho( *static_cast< const EchoBuffer * >( mRingBuffer.GetConstBuffer( aBuffer )->mBuffer ), aIndex );
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -173,7 +422,8 @@ LdResultEchoes::GetEchoDistance( size_t aIndex ) const
         assert( 0 );
     }
 
-    return static_cast<float>( static_cast< const EchoBuffer * >( mDoubleBuffer.GetConstBuffer( B_GET )->mBuffer )->mEchoes[aIndex].mDistance ) / mDistanceScale;
+    const EchoBuffer *lBuffer = static_cast< const EchoBuffer * >( mRingBuffer.GetConstBuffer( B_GET )->mBuffer );
+    return static_cast<float>( mColumnLayout ? lBuffer->mColumns.mDistances[aIndex] : lBuffer->mEchoes[aIndex].mDistance ) / mDistanceScale;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -196,7 +446,8 @@ LdResultEchoes::GetEchoAmplitude( size_t aIndex ) const
         assert( 0 );
     }
 
-    return static_cast<float>( static_cast< EchoBuffer * >( mDoubleBuffer.GetConstBuffer( B_GET )->mBuffer )->mEchoes[aIndex].mAmplitude ) / mAmplitudeScale;
+    const EchoBuffer *lBuffer = static_cast< const EchoBuffer * >( mRingBuffer.GetConstBuffer( B_GET )->mBuffer );
+    return static_cast<float>( mColumnLayout ? lBuffer->mColumns.mAmplitudes[aIndex] : lBuffer->mEchoes[aIndex].mAmplitude ) / mAmplitudeScale;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -213,7 +464,117 @@ LdResultEchoes::GetEchoAmplitude( size_t aIndex ) const
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 LeddarUtils::LtMathUtils::LtPointXYZ LeddarConnection::LdResultEchoes::GetEchoCoordinates( size_t aIndex ) const
 {
-    return static_cast< EchoBuffer * >( mDoubleBuffer.GetConstBuffer( B_GET )->mBuffer )->mEchoes[aIndex].ToXYZ( mHFOV, mVFOV, mHChan, mVChan, mDistanceScale );
+    return GetEcho( aIndex ).ToXYZ( mHFOV, mVFOV, mHChan, mVChan, mDistanceScale );
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn size_t LeddarConnection::LdResultEchoes::GetPointCloud( float *aXYZ, size_t aCapacity, eBuffer aBuffer ) const
+///
+/// \brief  Converts all the echoes of a frame to cartesian coordinates, using the per channel direction table.
+///         Same axis as LdEcho::ToXYZ. Echoes on a channel outside the field of view get NaN coordinates.
+///
+/// \exception  std::invalid_argument   Thrown when the fields of view and the channel numbers are not set.
+///
+/// \param [out]    aXYZ        Destination buffer, x, y, z of each point one after the other.
+/// \param          aCapacity   Capacity of the destination buffer in points (3 floats per point).
+/// \param          aBuffer     The buffer.
+///
+/// \return The number of points written, one per echo in the same order.
+///
+/// \author David Levy
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+size_t
+LeddarConnection::LdResultEchoes::GetPointCloud( float *aXYZ, size_t aCapacity, eBuffer aBuffer ) const
+{
+    if( mDirections.empty() )
+    {
+        throw std::invalid_argument( "Fields of view and channel numbers are not set" );
+    }
+
+    const EchoBuffer *lBuffer = static_cast< const EchoBuffer * >( mRingBuffer.GetConstBuffer( aBuffer )->mBuffer );
+    const size_t lCount = std::min<size_t>( lBuffer->mCount, aCapacity );
+    const size_t lChannelCount = mDirections.size() / 3;
+    const float *lDirections = mDirections.data();
+    const float lScale = 1.0f / mDistanceScale;
+    const float lNaN = std::numeric_limits<float>::quiet_NaN();
+
+    if( mColumnLayout )
+    {
+        const int32_t *lDistances = lBuffer->mColumns.mDistances.data();
+        const uint16_t *lChannels = lBuffer->mColumns.mChannelIndexes.data();
+
+        for( size_t i = 0; i < lCount; ++i )
+        {
+            const float lRho = lChannels[i] < lChannelCount ? lDistances[i] * lScale : lNaN;
+            const float *lDirection = &lDirections[3 * ( lChannels[i] < lChannelCount ? lChannels[i] : 0 )];
+            aXYZ[3 * i] = lRho * lDirection[0];
+            aXYZ[3 * i + 1] = lRho * lDirection[1];
+            aXYZ[3 * i + 2] = lRho * lDirection[2];
+        }
+    }
+    else
+    {
+        const LdEcho *lEchoes = lBuffer->mEchoes.data();
+
+        for( size_t i = 0; i < lCount; ++i )
+        {
+            const uint16_t lChannel = lEchoes[i].mChannelIndex;
+            const float lRho = lChannel < lChannelCount ? lEchoes[i].mDistance * lScale : lNaN;
+            const float *lDirection = &lDirections[3 * ( lChannel < lChannelCount ? lChannel : 0 )];
+            aXYZ[3 * i] = lRho * lDirection[0];
+            aXYZ[3 * i + 1] = lRho * lDirection[1];
+            aXYZ[3 * i + 2] = lRho * lDirection[2];
+        }
+    }
+
+    return lCount;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LeddarConnection::LdResultEchoes::UpdateDirections( void )
+///
+/// \brief  Rebuild the per channel direction table. Called when a field of view or a channel number changes.
+///         The table is left empty until the four values are valid.
+///
+/// \author David Levy
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void
+LeddarConnection::LdResultEchoes::UpdateDirections( void )
+{
+    mDirections.clear();
+
+    if( mHFOV < 0 || mVFOV < 0 || mHChan == 0 || mVChan == 0 )
+    {
+        return;
+    }
+
+    mDirections.resize( 3 * mHChan * mVChan );
+
+    try
+    {
+        for( uint16_t lVIndex = 0; lVIndex < mVChan; ++lVIndex )
+        {
+            //Same angles as LdEcho::ToXYZ
+            double lDelta = LeddarUtils::LtMathUtils::DegreeToRadian( lVIndex * mVFOV / mVChan + mVFOV / ( 2.0 * mVChan ) - mVFOV / 2 );
+
+            for( uint16_t lHIndex = 0; lHIndex < mHChan; ++lHIndex )
+            {
+                double lTheta = LeddarUtils::LtMathUtils::DegreeToRadian( lHIndex * mHFOV / mHChan + mHFOV / ( 2.0 * mHChan ) - mHFOV / 2 );
+                LeddarUtils::LtMathUtils::LtPointXYZ lDirection = LeddarUtils::LtMathUtils::SphericalToCartesian( 1.0, lTheta, lDelta );
+                size_t lChannel = static_cast<size_t>( lVIndex ) * mHChan + lHIndex;
+                mDirections[3 * lChannel] = static_cast<float>( lDirection.x );
+                mDirections[3 * lChannel + 1] = static_cast<float>( lDirection.y );
+                mDirections[3 * lChannel + 2] = static_cast<float>( lDirection.z );
+            }
+        }
+    }
+    catch( std::out_of_range & )
+    {
+        //Fields of view bigger than a full turn
+        mDirections.clear();
+    }
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -236,7 +597,217 @@ LdResultEchoes::GetEchoBase( size_t aIndex ) const
         assert( 0 );
     }
 
-    return static_cast<float>( static_cast< EchoBuffer * >( mDoubleBuffer.GetConstBuffer( B_GET )->mBuffer )->mEchoes[aIndex].mBase ) / mAmplitudeScale;
+    const EchoBuffer *lBuffer = static_cast< const EchoBuffer * >( mRingBuffer.GetConstBuffer( B_GET )->mBuffer );
+    return static_cast<float>( mColumnLayout ? lBuffer->mColumns.mBases[aIndex] : lBuffer->mEchoes[aIndex].mBase ) / mAmplitudeScale;
+}
+
+namespace
+{
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn void ScaleField( const T *aSource, size_t aStride, size_t aCount, float aFactor, float *aDest )
+    ///
+    /// \brief  Convert and scale one echo field. The contiguous case (columns) is a plain loop the compiler vectorizes.
+    ///
+    /// \param          aSource Pointer to the field of the first echo.
+    /// \param          aStride Spacing in bytes between two values.
+    /// \param          aCount  Number of values.
+    /// \param          aFactor Scale factor (inverse of the result scale).
+    /// \param [out]    aDest   Destination.
+    ///
+    /// \author David Levy
+    /// \date   October 2026
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    template<typename T>
+    void ScaleField( const T *aSource, size_t aStride, size_t aCount, float aFactor, float *aDest )
+    {
+        if( aStride == sizeof( T ) )
+        {
+            for( size_t i = 0; i < aCount; ++i )
+            {
+                aDest[i] = static_cast<float>( aSource[i] ) * aFactor;
+            }
+        }
+        else
+        {
+            const uint8_t *lSource = reinterpret_cast<const uint8_t *>( aSource );
+
+            for( size_t i = 0; i < aCount; ++i )
+            {
+                aDest[i] = static_cast<float>( *reinterpret_cast<const T *>( lSource + i * aStride ) ) * aFactor;
+            }
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn void CopyField( const T *aSource, size_t aStride, size_t aCount, T *aDest )
+    ///
+    /// \brief  Copy one echo field without conversion
+    ///
+    /// \author David Levy
+    /// \date   October 2026
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    template<typename T>
+    void CopyField( const T *aSource, size_t aStride, size_t aCount, T *aDest )
+    {
+        if( aStride == sizeof( T ) )
+        {
+            memcpy( aDest, aSource, aCount * sizeof( T ) );
+        }
+        else
+        {
+            const uint8_t *lSource = reinterpret_cast<const uint8_t *>( aSource );
+
+            for( size_t i = 0; i < aCount; ++i )
+            {
+                aDest[i] = *reinterpret_cast<const T *>( lSource + i * aStride );
+            }
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn size_t LeddarConnection::LdResultEchoes::CopyDistances( float *aDistances, size_t aCapacity, eBuffer aBuffer ) const
+///
+/// \brief  Copy the scaled distances of all the echoes of a frame
+///
+/// \param [out]    aDistances  Destination buffer.
+/// \param          aCapacity   Capacity of the destination buffer.
+/// \param          aBuffer     The buffer.
+///
+/// \return The number of values copied.
+///
+/// \author David Levy
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+size_t
+LeddarConnection::LdResultEchoes::CopyDistances( float *aDistances, size_t aCapacity, eBuffer aBuffer ) const
+{
+    return CopyFrame( aDistances, nullptr, nullptr, nullptr, aCapacity, aBuffer );
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn size_t LeddarConnection::LdResultEchoes::CopyAmplitudes( float *aAmplitudes, size_t aCapacity, eBuffer aBuffer ) const
+///
+/// \brief  Copy the scaled amplitudes of all the echoes of a frame
+///
+/// \param [out]    aAmplitudes Destination buffer.
+/// \param          aCapacity   Capacity of the destination buffer.
+/// \param          aBuffer     The buffer.
+///
+/// \return The number of values copied.
+///
+/// \author David Levy
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+size_t
+LeddarConnection::LdResultEchoes::CopyAmplitudes( float *aAmplitudes, size_t aCapacity, eBuffer aBuffer ) const
+{
+    return CopyFrame( nullptr, aAmplitudes, nullptr, nullptr, aCapacity, aBuffer );
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn size_t LeddarConnection::LdResultEchoes::CopyBases( float *aBases, size_t aCapacity, eBuffer aBuffer ) const
+///
+/// \brief  Copy the scaled bases of all the echoes of a frame
+///
+/// \param [out]    aBases      Destination buffer.
+/// \param          aCapacity   Capacity of the destination buffer.
+/// \param          aBuffer     The buffer.
+///
+/// \return The number of values copied.
+///
+/// \author David Levy
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+size_t
+LeddarConnection::LdResultEchoes::CopyBases( float *aBases, size_t aCapacity, eBuffer aBuffer ) const
+{
+    if( !mIsInitialized )
+    {
+        assert( 0 );
+    }
+
+    const EchoBuffer *lBuffer = static_cast< const EchoBuffer * >( mRingBuffer.GetConstBuffer( aBuffer )->mBuffer );
+    const size_t lCount = std::min<size_t>( lBuffer->mCount, aCapacity );
+
+    if( lCount == 0 )
+        return 0;
+
+    if( mColumnLayout )
+        ScaleField( lBuffer->mColumns.mBases.data(), sizeof( uint32_t ), lCount, 1.0f / mAmplitudeScale, aBases );
+    else
+        ScaleField( &lBuffer->mEchoes[0].mBase, sizeof( LdEcho ), lCount, 1.0f / mAmplitudeScale, aBases );
+
+    return lCount;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn size_t LeddarConnection::LdResultEchoes::CopyFrame( float *aDistances, float *aAmplitudes, uint16_t *aChannelIndexes, uint16_t *aFlags, size_t aCapacity, eBuffer aBuffer ) const
+///
+/// \brief  Copy all the echoes of a frame, one array per field. Distances and amplitudes are scaled with a single multiply by the inverse scale.
+///         Faster than calling GetEchoDistance / GetEchoAmplitude for each echo: the buffer is resolved once and each field is converted in one loop.
+///
+/// \param [out]    aDistances      Scaled distances destination, nullptr to skip.
+/// \param [out]    aAmplitudes     Scaled amplitudes destination, nullptr to skip.
+/// \param [out]    aChannelIndexes Channel indexes destination, nullptr to skip.
+/// \param [out]    aFlags          Flags destination, nullptr to skip.
+/// \param          aCapacity       Capacity of each destination buffer.
+/// \param          aBuffer         The buffer.
+///
+/// \return The number of echoes copied.
+///
+/// \author David Levy
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+size_t
+LeddarConnection::LdResultEchoes::CopyFrame( float *aDistances, float *aAmplitudes, uint16_t *aChannelIndexes, uint16_t *aFlags, size_t aCapacity,
+        eBuffer aBuffer ) const
+{
+    if( !mIsInitialized )
+    {
+        assert( 0 );
+    }
+
+    const EchoBuffer *lBuffer = static_cast< const EchoBuffer * >( mRingBuffer.GetConstBuffer( aBuffer )->mBuffer );
+    const size_t lCount = std::min<size_t>( lBuffer->mCount, aCapacity );
+
+    if( lCount == 0 )
+        return 0;
+
+    if( mColumnLayout )
+    {
+        const EchoColumns &lColumns = lBuffer->mColumns;
+
+        if( aDistances )
+            ScaleField( lColumns.mDistances.data(), sizeof( int32_t ), lCount, 1.0f / mDistanceScale, aDistances );
+
+        if( aAmplitudes )
+            ScaleField( lColumns.mAmplitudes.data(), sizeof( uint32_t ), lCount, 1.0f / mAmplitudeScale, aAmplitudes );
+
+        if( aChannelIndexes )
+            CopyField( lColumns.mChannelIndexes.data(), sizeof( uint16_t ), lCount, aChannelIndexes );
+
+        if( aFlags )
+            CopyField( lColumns.mFlags.data(), sizeof( uint16_t ), lCount, aFlags );
+    }
+    else
+    {
+        const LdEcho &lFirst = lBuffer->mEchoes[0];
+
+        if( aDistances )
+            ScaleField( &lFirst.mDistance, sizeof( LdEcho ), lCount, 1.0f / mDistanceScale, aDistances );
+
+        if( aAmplitudes )
+            ScaleField( &lFirst.mAmplitude, sizeof( LdEcho ), lCount, 1.0f / mAmplitudeScale, aAmplitudes );
+
+        if( aChannelIndexes )
+            CopyField( &lFirst.mChannelIndex, sizeof( LdEcho ), lCount, aChannelIndexes );
+
+        if( aFlags )
+            CopyField( &lFirst.mFlag, sizeof( LdEcho ), lCount, aFlags );
+    }
+
+    return lCount;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -252,14 +823,7 @@ LdResultEchoes::GetEchoBase( size_t aIndex ) const
 void
 LeddarConnection::LdResultEchoes::SetCurrentLedPower( uint16_t aValue )
 {
-    if( mCurrentLedPower.Count() < 2 )
-    {
-        mCurrentLedPower.ForceValue( 0, aValue );
-    }
-    else
-    {
-        mCurrentLedPower.ForceValue( 1, aValue );
-    }
+    static_cast< EchoBuffer * >( mRingBuffer.GetBuffer( B_SET )->mBuffer )->mCurrentLedPower = aValue;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -277,14 +841,198 @@ LeddarConnection::LdResultEchoes::SetCurrentLedPower( uint16_t aValue )
 uint16_t
 LeddarConnection::LdResultEchoes::GetCurrentLedPower( eBuffer aBuffer ) const
 {
-    if( ( mCurrentLedPower.Count() < 2 || aBuffer == B_GET ) )
+    return static_cast< const EchoBuffer * >( mRingBuffer.GetConstBuffer( aBuffer )->mBuffer )->mCurrentLedPower;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn LeddarConnection::LdEchoFrame::LdEchoFrame( void )
+///
+/// \brief  Constructor of an empty handle
+///
+/// \author David Levy
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+LeddarConnection::LdEchoFrame::LdEchoFrame( void ) :
+    mOwner( nullptr ),
+    mFrame( 0 )
+{
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn LeddarConnection::LdEchoFrame::LdEchoFrame( const LdEchoFrame &aFrame )
+///
+/// \brief  Copy constructor, shares the frame
+///
+/// \author David Levy
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+LeddarConnection::LdEchoFrame::LdEchoFrame( const LdEchoFrame &aFrame ) :
+    mOwner( aFrame.mOwner ),
+    mFrame( aFrame.mFrame )
+{
+    if( mOwner )
     {
-        return static_cast<uint32_t>( mCurrentLedPower.Value( 0 ) );
+        mOwner->RetainFrame( mFrame );
     }
-    else
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn LeddarConnection::LdEchoFrame::LdEchoFrame( LdEchoFrame &&aFrame )
+///
+/// \brief  Move constructor, takes the reference of aFrame
+///
+/// \author David Levy
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+LeddarConnection::LdEchoFrame::LdEchoFrame( LdEchoFrame &&aFrame ) :
+    mOwner( aFrame.mOwner ),
+    mFrame( aFrame.mFrame )
+{
+    aFrame.mOwner = nullptr;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn LeddarConnection::LdEchoFrame &LeddarConnection::LdEchoFrame::operator=( const LdEchoFrame &aFrame )
+///
+/// \brief  Assignment operator, releases the current frame and shares aFrame
+///
+/// \author David Levy
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+LeddarConnection::LdEchoFrame &
+LeddarConnection::LdEchoFrame::operator=( const LdEchoFrame &aFrame )
+{
+    if( this == &aFrame )
+        return *this;
+
+    if( aFrame.mOwner )
     {
-        return static_cast<uint32_t>( mCurrentLedPower.Value( 1 ) );
+        aFrame.mOwner->RetainFrame( aFrame.mFrame );
     }
+
+    Reset();
+    mOwner = aFrame.mOwner;
+    mFrame = aFrame.mFrame;
+    return *this;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn LeddarConnection::LdEchoFrame &LeddarConnection::LdEchoFrame::operator=( LdEchoFrame &&aFrame )
+///
+/// \brief  Move assignment operator, releases the current frame and takes the reference of aFrame
+///
+/// \author David Levy
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+LeddarConnection::LdEchoFrame &
+LeddarConnection::LdEchoFrame::operator=( LdEchoFrame &&aFrame )
+{
+    if( this == &aFrame )
+        return *this;
+
+    Reset();
+    mOwner = aFrame.mOwner;
+    mFrame = aFrame.mFrame;
+    aFrame.mOwner = nullptr;
+    return *this;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn LeddarConnection::LdEchoFrame::~LdEchoFrame()
+///
+/// \brief  Destructor, releases the frame
+///
+/// \author David Levy
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+LeddarConnection::LdEchoFrame::~LdEchoFrame()
+{
+    Reset();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LeddarConnection::LdEchoFrame::Reset( void )
+///
+/// \brief  Releases the frame, the handle becomes empty
+///
+/// \author David Levy
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void
+LeddarConnection::LdEchoFrame::Reset( void )
+{
+    if( mOwner )
+    {
+        mOwner->ReleaseFrame( mFrame );
+        mOwner = nullptr;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn const LeddarConnection::EchoBuffer *LeddarConnection::LdEchoFrame::GetBuffer( void ) const
+///
+/// \brief  Gets the frame buffer
+///
+/// \exception  std::logic_error    Thrown when the handle is empty.
+///
+/// \author David Levy
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+const LeddarConnection::EchoBuffer *
+LeddarConnection::LdEchoFrame::GetBuffer( void ) const
+{
+    if( !mOwner )
+    {
+        throw std::logic_error( "Empty frame handle" );
+    }
+
+    return mOwner->GetFrameEchoes( mFrame );
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn uint64_t LeddarConnection::LdEchoFrame::GetSequence( void ) const
+///
+/// \brief  Gets the frame sequence number
+///
+/// \author David Levy
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+uint64_t
+LeddarConnection::LdEchoFrame::GetSequence( void ) const
+{
+    GetBuffer();
+    return mOwner->GetFrameSequence( mFrame );
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn uint32_t LeddarConnection::LdEchoFrame::GetTimestamp( void ) const
+///
+/// \brief  Gets the frame timestamp
+///
+/// \author David Levy
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+uint32_t
+LeddarConnection::LdEchoFrame::GetTimestamp( void ) const
+{
+    GetBuffer();
+    return mOwner->GetFrameTimestamp( mFrame );
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn LeddarConnection::LdEcho LeddarConnection::LdEchoFrame::GetEcho( size_t aIndex ) const
+///
+/// \brief  Gets an echo of the frame, whatever its layout
+///
+/// \param  aIndex  Echo index.
+///
+/// \author David Levy
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+LeddarConnection::LdEcho
+LeddarConnection::LdEchoFrame::GetEcho( size_t aIndex ) const
+{
+    return ReadEcho( *GetBuffer(), aIndex );
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -341,16 +1089,15 @@ std::string
 LdResultEchoes::ToString( void )
 {
     std::stringstream lResult;
-    mDoubleBuffer.Lock( B_GET );
-
-    std::vector<LdEcho> lEchoes = static_cast< EchoBuffer * >( mDoubleBuffer.GetConstBuffer( B_GET )->mBuffer )->mEchoes;
+    mRingBuffer.Lock( B_GET );
 
-    for( uint32_t i = 0; i < static_cast< EchoBuffer * >( mDoubleBuffer.GetConstBuffer( B_GET )->mBuffer )->mCount; ++i )
+    for( uint32_t i = 0; i < static_cast< EchoBuffer * >( mRingBuffer.GetConstBuffer( B_GET )->mBuffer )->mCount; ++i )
     {
-        lResult << "[" << lEchoes[ i ].mChannelIndex << "]:\t " << lEchoes[ i ].mAmplitude << "\t " << lEchoes[ i ].mDistance << std::endl;
+        LdEcho lEcho = GetEcho( i );
+        lResult << "[" << lEcho.mChannelIndex << "]:\t " << lEcho.mAmplitude << "\t " << lEcho.mDistance << std::endl;
     }
 
-    mDoubleBuffer.UnLock( B_GET );
+    mRingBuffer.UnLock( B_GET );
     return lResult.str();
 }
 
@@ -10,9 +10,10 @@
 
 #include "LdIntegerProperty.h"
 #include "LdResultProvider.h"
-#include "LdDoubleBuffer.h"
+#include "LdRingBuffer.h"
 
 #include <cassert>
+#include <stdexcept>
 
 namespace LeddarUtils
 {
@@ -42,14 +43,94 @@ namespace LeddarConnection
         }
     };
 
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \struct LdEchoColumn
+    ///
+    /// \brief  Contiguous view over one field of the echoes of a frame (pointer + size), see LdResultEchoes::SetColumnLayout.
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    template<typename T>
+    struct LdEchoColumn
+    {
+        LdEchoColumn( T *aData, size_t aSize ) : mData( aData ), mSize( aSize ) {}
+        T      *Data( void ) const { return mData; }
+        size_t  Size( void ) const { return mSize; }
+        T      *begin( void ) const { return mData; }
+        T      *end( void ) const { return mData + mSize; }
+        T      &operator[]( size_t aIndex ) const { assert( aIndex < mSize ); return mData[aIndex]; }
+
+    private:
+        T      *mData;
+        size_t  mSize;
+    };
+
+    typedef struct EchoColumns
+    {
+        std::vector<int32_t>  mDistances;
+        std::vector<uint32_t> mAmplitudes;
+        std::vector<uint32_t> mBases;
+        std::vector<uint16_t> mChannelIndexes;
+        std::vector<uint16_t> mFlags;
+    } EchoColumns;
+
     typedef struct EchoBuffer
     {
-        EchoBuffer(): mCount( 0 ), mScanDirection( 0 ) {};
+        EchoBuffer(): mCount( 0 ), mCurrentLedPower( 0 ), mScanDirection( 0 ), mColumnsWritten( false ), mHostTimestamp( 0 ) {};
         std::vector<LdEcho> mEchoes;
+        EchoColumns mColumns;   ///< Only allocated with the column layout
         uint32_t    mCount;
+        uint16_t    mCurrentLedPower;
         uint8_t mScanDirection;
+        bool        mColumnsWritten; ///< The producer wrote the columns directly, mEchoes is not filled
+        uint64_t    mHostTimestamp;  ///< Host monotonic time (ns) at which the frame was received, see LdResultProvider::GetHostTimestamp
     } EchoBuffer;
 
+    class LdResultEchoes;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \class  LdEchoFrame
+    ///
+    /// \brief  Read-only, reference counted handle on a frame of LdResultEchoes (see LdResultEchoes::GetFrame).
+    ///
+    ///         The frame buffer is pinned in the result ring as long as a handle on it exists, so the handle can be queued
+    ///         or passed to another thread without copying the echoes. Copying the handle only increments the reference count.
+    ///         The buffer goes back to the producer when the last handle is destroyed.
+    ///         At most LdResultEchoes::GetFrameSlotCount() - 2 frames can be held at the same time, the sensor drops the new
+    ///         frames beyond that (LdResultEchoes::GetDroppedFrameCount).
+    ///         A handle must not outlive the LdResultEchoes it comes from.
+    ///
+    /// \author David Levy
+    /// \date   October 2026
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    class LdEchoFrame
+    {
+    public:
+        LdEchoFrame( void );
+        LdEchoFrame( const LdEchoFrame &aFrame );
+        LdEchoFrame( LdEchoFrame &&aFrame );
+        LdEchoFrame &operator=( const LdEchoFrame &aFrame );
+        LdEchoFrame &operator=( LdEchoFrame &&aFrame );
+        ~LdEchoFrame();
+
+        bool                IsValid( void ) const { return mOwner != nullptr; }
+        void                Reset( void );
+
+        uint64_t            GetSequence( void ) const;
+        uint32_t            GetTimestamp( void ) const;
+        uint64_t            GetHostTimestamp( void ) const { return GetBuffer()->mHostTimestamp; }
+        uint16_t            GetCurrentLedPower( void ) const { return GetBuffer()->mCurrentLedPower; }
+        uint8_t             GetScanDirection( void ) const { return GetBuffer()->mScanDirection; }
+        uint32_t            GetEchoCount( void ) const { return GetBuffer()->mCount; }
+        LdEcho              GetEcho( size_t aIndex ) const;
+        const EchoBuffer   *GetBuffer( void ) const;
+
+    private:
+        friend class LdResultEchoes;
+        LdEchoFrame( LdResultEchoes *aOwner, size_t aFrame ) : mOwner( aOwner ), mFrame( aFrame ) {}
+
+        LdResultEchoes *mOwner;
+        size_t          mFrame;
+    };
+
     ////////////////////////////////////////////////////////////////////////////////////////////////////
     /// \class  LdResultEchoes.
     ///
@@ -61,25 +142,50 @@ namespace LeddarConnection
     class LdResultEchoes : public LdResultProvider
     {
     public:
+        static const uint32_t DEFAULT_FRAME_COUNT = 4; ///< Producer frame + latest frame + frames held by consumers
+
         LdResultEchoes( void );
         ~LdResultEchoes();
 
-        void        Init( uint32_t aDistanceScale, uint32_t aAmplitudeScale, uint32_t aMaxDetections );
+        void        Init( uint32_t aDistanceScale, uint32_t aAmplitudeScale, uint32_t aMaxDetections, uint32_t aFrameCount = DEFAULT_FRAME_COUNT );
         bool        IsInitialized( void ) const { return mIsInitialized;  }
         void        Swap();
-        uint32_t    GetTimestamp( eBuffer aBuffer = B_GET ) const {return mDoubleBuffer.GetTimestamp( aBuffer );}
-        void        SetTimestamp( uint32_t aTimestamp ) override { mDoubleBuffer.SetTimestamp( aTimestamp );}
-        void        Lock( eBuffer aBuffer ) {mDoubleBuffer.Lock( aBuffer );}
-        void        UnLock( eBuffer aBuffer ) {mDoubleBuffer.UnLock( aBuffer );}
+        uint32_t    GetTimestamp( eBuffer aBuffer = B_GET ) const {return mRingBuffer.GetTimestamp( aBuffer );}
+        void        SetTimestamp( uint32_t aTimestamp ) override;
+        uint64_t    GetHostTimestamp( void ) const override { return GetHostTimestamp( B_GET ); }
+        uint64_t    GetHostTimestamp( eBuffer aBuffer ) const { return static_cast< const EchoBuffer * >( mRingBuffer.GetConstBuffer( aBuffer )->mBuffer )->mHostTimestamp; }
+        void        SetHostTimestamp( uint64_t aHostTimestamp ) override;
+        uint64_t    GetAcquisitionDelay( void ) const override { return GetAcquisitionDelay( B_GET ); }
+        uint64_t    GetAcquisitionDelay( eBuffer aBuffer ) const;
+        uint64_t    GetSequence( eBuffer aBuffer = B_GET ) const { return mRingBuffer.GetSequence( aBuffer ); }
+        void        Lock( eBuffer aBuffer ) {mRingBuffer.Lock( aBuffer );}
+        void        UnLock( eBuffer aBuffer ) {mRingBuffer.UnLock( aBuffer );}
+
+        //Lock-free access to the latest complete frame, the frame stays valid until released
+        size_t              AcquireFrame( void ) { return mRingBuffer.AcquireLatest(); }
+        void                RetainFrame( size_t aFrame ) { mRingBuffer.Retain( aFrame ); }
+        void                ReleaseFrame( size_t aFrame ) { mRingBuffer.Release( aFrame ); }
+        LdEchoFrame         GetFrame( void ) { return LdEchoFrame( this, mRingBuffer.AcquireLatest() ); }
+        size_t              GetFrameSlotCount( void ) const { return mRingBuffer.GetSlotCount(); }
+        uint64_t            GetDroppedFrameCount( void ) const { return mRingBuffer.GetDroppedCount(); }
+        const EchoBuffer   *GetFrameEchoes( size_t aFrame ) const { return static_cast< const EchoBuffer * >( mRingBuffer.GetSlotBuffer( aFrame )->mBuffer ); }
+        uint32_t            GetFrameTimestamp( size_t aFrame ) const { return mRingBuffer.GetSlotTimestamp( aFrame ); }
+        uint64_t            GetFrameSequence( size_t aFrame ) const { return mRingBuffer.GetSlotSequence( aFrame ); }
+        uint64_t            GetFrameHostTimestamp( size_t aFrame ) const { return GetFrameEchoes( aFrame )->mHostTimestamp; }
 
         uint32_t            GetEchoCount( eBuffer aBuffer = B_GET ) const;
         std::vector<LdEcho> *GetEchoes( eBuffer aBuffer = B_GET );
+        LdEcho              GetEcho( size_t aIndex, eBuffer aBuffer = B_GET ) const;
         float               GetEchoDistance( size_t aIndex ) const;
         float               GetEchoAmplitude( size_t aIndex ) const;
         LeddarUtils::LtMathUtils::LtPointXYZ GetEchoCoordinates( size_t aIndex ) const;
         float               GetEchoBase( size_t aIndex ) const;
-        size_t              GetEchoesSize( void ) const { return static_cast< EchoBuffer * >( mDoubleBuffer.GetConstBuffer( B_GET )->mBuffer )->mEchoes.size(); }
-        void                SetEchoCount( uint32_t aValue ) { static_cast< EchoBuffer * >( mDoubleBuffer.GetBuffer( B_SET )->mBuffer )->mCount = aValue; }
+        size_t              CopyDistances( float *aDistances, size_t aCapacity, eBuffer aBuffer = B_GET ) const;
+        size_t              CopyAmplitudes( float *aAmplitudes, size_t aCapacity, eBuffer aBuffer = B_GET ) const;
+        size_t              CopyBases( float *aBases, size_t aCapacity, eBuffer aBuffer = B_GET ) const;
+        size_t              CopyFrame( float *aDistances, float *aAmplitudes, uint16_t *aChannelIndexes, uint16_t *aFlags, size_t aCapacity, eBuffer aBuffer = B_GET ) const;
+        size_t              GetEchoesSize( void ) const { return static_cast< EchoBuffer * >( mRingBuffer.GetConstBuffer( B_GET )->mBuffer )->mEchoes.size(); }
+        void                SetEchoCount( uint32_t aValue ) { static_cast< EchoBuffer * >( mRingBuffer.GetBuffer( B_SET )->mBuffer )->mCount = aValue; }
 
         void                SetCurrentLedPower( uint16_t aValue );
         uint16_t            GetCurrentLedPower( eBuffer aBuffer = B_GET ) const;
@@ -88,33 +194,60 @@ namespace LeddarConnection
         uint32_t            GetAmplitudeScale( void ) const {return mAmplitudeScale;}
         void                SetAmplitudeScale( uint32_t aNewScale )  { mAmplitudeScale = aNewScale;}
 
-        uint8_t             GetScanDirection( eBuffer aBuffer = B_GET ) const { return static_cast< EchoBuffer * >( mDoubleBuffer.GetConstBuffer( aBuffer )->mBuffer )->mScanDirection; }
-        void                SetScanDirection( uint8_t aValue ) { static_cast< EchoBuffer * >( mDoubleBuffer.GetBuffer( B_SET )->mBuffer )->mScanDirection = aValue; }
+        //Structure of arrays layout
+        void                SetColumnLayout( bool aEnable );
+        bool                IsColumnLayout( void ) const { return mColumnLayout; }
+        EchoColumns        *GetColumns( eBuffer aBuffer = B_SET );
+        LdEchoColumn<const int32_t>  GetDistances( eBuffer aBuffer = B_GET ) const { return MakeColumn( &EchoColumns::mDistances, aBuffer ); }
+        LdEchoColumn<const uint32_t> GetAmplitudes( eBuffer aBuffer = B_GET ) const { return MakeColumn( &EchoColumns::mAmplitudes, aBuffer ); }
+        LdEchoColumn<const uint32_t> GetBases( eBuffer aBuffer = B_GET ) const { return MakeColumn( &EchoColumns::mBases, aBuffer ); }
+        LdEchoColumn<const uint16_t> GetChannelIndexes( eBuffer aBuffer = B_GET ) const { return MakeColumn( &EchoColumns::mChannelIndexes, aBuffer ); }
+        LdEchoColumn<const uint16_t> GetFlags( eBuffer aBuffer = B_GET ) const { return MakeColumn( &EchoColumns::mFlags, aBuffer ); }
+
+        uint8_t             GetScanDirection( eBuffer aBuffer = B_GET ) const { return static_cast< EchoBuffer * >( mRingBuffer.GetConstBuffer( aBuffer )->mBuffer )->mScanDirection; }
+        void                SetScanDirection( uint8_t aValue ) { static_cast< EchoBuffer * >( mRingBuffer.GetBuffer( B_SET )->mBuffer )->mScanDirection = aValue; }
 
 
         //Useful for cartesian coordinates
         double              GetVFOV( void ) const { return mVFOV; }
-        void                SetVFOV( const double aVFOV ) { mVFOV = aVFOV; }
+        void                SetVFOV( const double aVFOV ) { mVFOV = aVFOV; UpdateDirections(); }
         double              GetHFOV( void ) const { return mHFOV; }
-        void                SetHFOV( const double aHFOV ) { mHFOV = aHFOV; }
+        void                SetHFOV( const double aHFOV ) { mHFOV = aHFOV; UpdateDirections(); }
         uint16_t            GetHChan( void ) const { return mHChan; }
-        void                SetHChan( const uint16_t aHChan ) { mHChan = aHChan; }
+        void                SetHChan( const uint16_t aHChan ) { mHChan = aHChan; UpdateDirections(); }
         uint16_t            GetVChan( void ) const { return mVChan; }
-        void                SetVChan( const uint16_t aVChan ) { mVChan = aVChan; }
+        void                SetVChan( const uint16_t aVChan ) { mVChan = aVChan; UpdateDirections(); }
+        size_t              GetPointCloud( float *aXYZ, size_t aCapacity, eBuffer aBuffer = B_GET ) const;
 
 #ifdef _DEBUG
         std::string ToString( void );
 #endif
 
     private:
+        template<typename T>
+        LdEchoColumn<const T> MakeColumn( std::vector<T> EchoColumns::*aColumn, eBuffer aBuffer ) const
+        {
+            const EchoBuffer *lBuffer = static_cast< const EchoBuffer * >( mRingBuffer.GetConstBuffer( aBuffer )->mBuffer );
+
+            if( !mColumnLayout )
+                throw std::logic_error( "Column layout is not enabled" );
+
+            return LdEchoColumn<const T>( ( lBuffer->mColumns.*aColumn ).data(), lBuffer->mCount );
+        }
+
+        void AllocateColumns( EchoBuffer &aBuffer ) const;
+        void UpdateDirections( void );
+        void FillColumns( EchoBuffer &aBuffer ) const;
+
         bool mIsInitialized;
+        bool mColumnLayout;
         uint32_t mDistanceScale;
         uint32_t mAmplitudeScale;
         double mHFOV, mVFOV;
         uint16_t mHChan, mVChan;
+        std::vector<float> mDirections; ///< Unit direction (x, y, z) of each channel, computed from the fields of view and channel numbers
 
-        LeddarCore::LdIntegerProperty mCurrentLedPower;
-        LdDoubleBuffer mDoubleBuffer;
-        EchoBuffer mEchoBuffer1, mEchoBuffer2;
+        LdRingBuffer mRingBuffer;
+        std::vector<EchoBuffer> mEchoBuffers;
     };
 }
@@ -14,6 +14,7 @@
 
 #include "LdResultProvider.h"
 #include "LdPropertyIds.h"
+#include "LtTimeUtils.h"
 
 // *****************************************************************************
 // Function: LdResultProvider::LdResultProvider
@@ -24,10 +25,76 @@
 ///
 /// \since   March 2016
 // *****************************************************************************
-LeddarConnection::LdResultProvider::LdResultProvider()
+LeddarConnection::LdResultProvider::LdResultProvider() :
+    mHostTimestampSet( false ),
+#ifdef BUILD_TIMING_STATS
+    mTimingStats( nullptr ),
+#endif
+    mHostTimestamp( 0 )
 {
     mTimestamp = new LeddarCore::LdIntegerProperty( LeddarCore::LdProperty::CAT_INFO, LeddarCore::LdProperty::F_NONE, LeddarCore::LdPropertyIds::ID_RS_TIMESTAMP, 0, 4, "Timestamp" );
     mTimestamp->ForceValue( 0, 0 );
     mProperties.AddProperty( mTimestamp );
 }
 
+// *****************************************************************************
+// Function: LdResultProvider::UpdateFinished
+//
+/// \brief   Notify the receivers that a new result is available.
+///
+/// \author  Patrick Boulay
+///
+/// \since   March 2016
+// *****************************************************************************
+void LeddarConnection::LdResultProvider::UpdateFinished( void )
+{
+    mHostTimestampSet = false;
+    LT_TIMING_BEGIN( lStart );
+    EmitSignal( LeddarCore::LdObject::NEW_DATA );
+    LT_TIMING_END( mTimingStats, TS_DISPATCH, lStart );
+}
+
+// *****************************************************************************
+// Function: LdResultProvider::SetTimestamp
+//
+/// \brief   Set the sensor timestamp of the result. Also takes the host
+///          timestamp if the sensor did not set it after its read.
+///
+/// \param   aTimestamp  Sensor timestamp.
+///
+/// \author  David Levy
+///
+/// \since   October 2026
+// *****************************************************************************
+void LeddarConnection::LdResultProvider::SetTimestamp( uint32_t aTimestamp )
+{
+    mTimestamp->ForceValue( 0, aTimestamp );
+
+    if( !mHostTimestampSet )
+    {
+        mHostTimestamp = LeddarUtils::LtTimeUtils::GetMonotonicNanoseconds();
+    }
+}
+
+// *****************************************************************************
+// Function: LdResultProvider::GetAcquisitionDelay
+//
+/// \brief   Time elapsed since the host received the latest result.
+///
+/// \return  Delay in nanoseconds, 0 if no result was received yet.
+///
+/// \author  David Levy
+///
+/// \since   October 2026
+// *****************************************************************************
+uint64_t LeddarConnection::LdResultProvider::GetAcquisitionDelay( void ) const
+{
+    uint64_t lHostTimestamp = mHostTimestamp;
+
+    if( lHostTimestamp == 0 )
+    {
+        return 0;
+    }
+
+    return LeddarUtils::LtTimeUtils::GetMonotonicNanoseconds() - lHostTimestamp;
+}
@@ -17,6 +17,9 @@
 #include "LdObject.h"
 #include "LdPropertiesContainer.h"
 #include "LdIntegerProperty.h"
+#include "LdTimingStats.h"
+
+#include <atomic>
 
 namespace LeddarConnection
 {
@@ -24,18 +27,33 @@ namespace LeddarConnection
     {
     public:
         LdResultProvider( void );
-        void UpdateFinished( void ) { EmitSignal( LeddarCore::LdObject::NEW_DATA ); }
+        void UpdateFinished( void );
 
         uint32_t        GetTimestamp( void ) const { return static_cast<uint32_t>( mTimestamp->Value() ); }
-        virtual void    SetTimestamp( uint32_t aTimestamp ) { mTimestamp->ForceValue( 0, aTimestamp ); }
+        virtual void    SetTimestamp( uint32_t aTimestamp );
+
+        //Host reception time (LtTimeUtils::GetMonotonicNanoseconds). Taken by SetTimestamp unless the sensor set it right after the read.
+        //LdResultEchoes keeps it per frame and returns the one of the latest frame
+        virtual uint64_t GetHostTimestamp( void ) const { return mHostTimestamp; }
+        virtual void    SetHostTimestamp( uint64_t aHostTimestamp ) { mHostTimestamp = aHostTimestamp; mHostTimestampSet = true; }
+        virtual uint64_t GetAcquisitionDelay( void ) const;
 
         LeddarCore::LdPropertiesContainer *GetProperties( void ) { return &mProperties; }
+#ifdef BUILD_TIMING_STATS
+        void SetTimingStats( LdTimingStats *aStats ) { mTimingStats = aStats; }
+#endif
 
     protected:
         LeddarCore::LdIntegerProperty *mTimestamp;
         LeddarCore::LdPropertiesContainer mProperties;
+        bool mHostTimestampSet; ///< SetHostTimestamp was called for the frame being written
+#ifdef BUILD_TIMING_STATS
+        LdTimingStats *mTimingStats; ///< Timing stats of the sensor, can be null
+#endif
 
     private:
+        std::atomic<uint64_t> mHostTimestamp;
+
         LdResultProvider( const LdResultProvider &aProvider ); //Disable copy constructor
         LdResultProvider &operator=( const LdResultProvider &aProvider );//Disable equal constructor
     };
@@ -0,0 +1,483 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \file   Leddar/LdRingBuffer.cpp
+///
+/// \brief  Implements the LdRingBuffer class
+///
+/// Copyright (c) 2018 LeddarTech. All rights reserved.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "LdRingBuffer.h"
+
+#include "LtTimeUtils.h"
+
+#include <chrono>
+#include <stdexcept>
+
+using namespace LeddarConnection;
+
+namespace
+{
+    const int TRANSIENT_PIN_WAIT_US = 100;      ///< A consumer retrying AcquireLatest pins a stale slot for a few instructions
+}
+
+const size_t LdRingBuffer::INVALID_SLOT;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn LdRingBuffer::LdRingBuffer()
+///
+/// \brief  Constructor
+///
+/// \author David Levy
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+LdRingBuffer::LdRingBuffer() :
+    mTimestamp( nullptr ),
+    mSlots( nullptr ),
+    mSlotCount( 0 ),
+    mSetSlot( 0 ),
+    mSequence( 0 ),
+    mDroppedCount( 0 ),
+    mLatestSlot( 0 ),
+    mLockedSlot( INVALID_SLOT ),
+    mLockCount( 0 )
+{
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn LdRingBuffer::~LdRingBuffer()
+///
+/// \brief  Destructor - Delete the slots allocated in Init
+///
+/// \author David Levy
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+LdRingBuffer::~LdRingBuffer()
+{
+    delete[] mSlots;
+    mSlots = nullptr;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LdRingBuffer::Init( const std::vector<void *> &aBuffers, LeddarCore::LdIntegerProperty *aTimestamp )
+///
+/// \brief  Initialize the ring. Must be called before using the class, and before any consumer thread is started.
+///
+/// \exception  std::invalid_argument   Thrown when less than two buffers are provided.
+///
+/// \param  aBuffers    Pointers to the data buffers, one per slot (at least 2, 3 or more to never block the producer).
+/// \param  aTimestamp  (optional) pointer to the timestamp integer property that will mirror the buffers timestamp.
+///
+/// \author David Levy
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void
+LdRingBuffer::Init( const std::vector<void *> &aBuffers, LeddarCore::LdIntegerProperty *aTimestamp )
+{
+    if( aBuffers.size() < 2 )
+    {
+        throw std::invalid_argument( "Ring buffer needs at least two buffers" );
+    }
+
+    delete[] mSlots;
+    mSlotCount = aBuffers.size();
+    mSlots = new sSlot[mSlotCount];
+
+    for( size_t i = 0; i < mSlotCount; ++i )
+    {
+        mSlots[i].mData.mBuffer = aBuffers[i];
+    }
+
+    //Slot 0 is the (empty) published frame, the producer starts writing in slot 1
+    mSequence = 0;
+    mDroppedCount = 0;
+    mSetSlot = 1;
+    mLatestSlot.store( 0 );
+    mLockedSlot.store( INVALID_SLOT );
+    mLockCount = 0;
+
+    mTimestamp = aTimestamp;
+
+    //Timestamp index 0 is Get buffer, index 1 is Set buffer
+    if( mTimestamp )
+    {
+        mTimestamp->SetCount( 2 );
+        mTimestamp->ForceValue( 1, 0 );
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LdRingBuffer::Swap()
+///
+/// \brief  Publish the frame written in the set slot and take the next free slot for writing.
+///         Only called by the producer. Never waits while the consumers retain at most GetSlotCount() - 2 frames.
+///         Beyond that, the new frame is dropped (not published, see GetDroppedCount) and the producer writes the next one
+///         in the same slot.
+///         If a consumer pins the new frame while the previous one is pinned too during the publication, the frame is also
+///         dropped and the producer waits until that consumer releases it or another slot is free.
+///
+/// \exception  std::logic_error    Thrown when the ring is not initialized.
+///
+/// \author David Levy
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void
+LdRingBuffer::Swap()
+{
+    if( mSlots == nullptr )
+        throw std::logic_error( "Buffers not initialized" );
+
+    //Only the producer changes the latest slot. The consumers can only pin the latest slot (or retain one they hold),
+    //so a free slot that is not the latest one stays free.
+    const size_t lPrevious = mLatestSlot.load();
+    size_t lNext = FindFreeSlot( lPrevious );
+
+    if( lNext == INVALID_SLOT )
+    {
+        std::chrono::steady_clock::time_point lEnd = std::chrono::steady_clock::now() + std::chrono::microseconds( TRANSIENT_PIN_WAIT_US );
+
+        while( lNext == INVALID_SLOT && std::chrono::steady_clock::now() < lEnd )
+        {
+            LeddarUtils::LtTimeUtils::WaitBlockingMicro( 1 );
+            lNext = FindFreeSlot( lPrevious );
+        }
+    }
+
+    if( lNext == INVALID_SLOT )
+    {
+        if( lPrevious == mSetSlot || mSlots[lPrevious].mReaders.load() != 0 )
+        {
+            ++mDroppedCount;
+            return;
+        }
+
+        lNext = lPrevious;
+    }
+
+    const size_t lPublished = mSetSlot;
+    mSlots[lPublished].mSequence = ++mSequence;
+    mLatestSlot.store( lPublished );
+
+    //The previous frame was the latest one until now, a consumer may have pinned it just before the publication
+    if( lNext == lPrevious && mSlots[lPrevious].mReaders.load() != 0 )
+    {
+        //Take the publication back if nobody pinned the new frame yet (a consumer that pins it now sees it is not the latest)
+        mLatestSlot.store( lPrevious );
+
+        if( mSlots[lPublished].mReaders.load() == 0 )
+        {
+            --mSequence;
+            ++mDroppedCount;
+            return;
+        }
+
+        //Both pinned: take the publication back anyway and drop the frame. The consumers that pinned it while it was
+        //published still read it, so the producer waits until they release it, or until another slot is free, before writing again.
+        lNext = FindFreeSlot( lPrevious );
+
+        while( lNext == INVALID_SLOT && mSlots[lPublished].mReaders.load() != 0 )
+        {
+            LeddarUtils::LtTimeUtils::WaitBlockingMicro( 1 );
+            lNext = FindFreeSlot( lPrevious );
+        }
+
+        //The sequence number is not taken back, these consumers have seen it
+        ++mDroppedCount;
+
+        if( lNext != INVALID_SLOT )
+            mSetSlot = lNext;
+
+        return;
+    }
+
+    mSetSlot = lNext;
+
+    if( mTimestamp && mTimestamp->Count() == 2 )
+    {
+        mTimestamp->ForceValue( 0, mSlots[lPublished].mTimestamp );
+        mTimestamp->ForceValue( 1, mSlots[mSetSlot].mTimestamp );
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn size_t LdRingBuffer::FindFreeSlot( size_t aLatest ) const
+///
+/// \brief  Find a slot pinned by nobody, other than the set slot and aLatest. Only called by the producer.
+///
+/// \param  aLatest The latest published slot.
+///
+/// \return The slot index, INVALID_SLOT if there is none.
+///
+/// \author David Levy
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+size_t
+LdRingBuffer::FindFreeSlot( size_t aLatest ) const
+{
+    for( size_t i = 1; i < mSlotCount; ++i )
+    {
+        size_t lCandidate = ( mSetSlot + i ) % mSlotCount;
+
+        if( lCandidate != aLatest && mSlots[lCandidate].mReaders.load() == 0 )
+            return lCandidate;
+    }
+
+    return INVALID_SLOT;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LdRingBuffer::Lock( eBuffer aBuffer )
+///
+/// \brief  Lock the get buffer: pin the latest frame, GetBuffer( B_GET ) returns it until UnLock.
+///         The set buffer belongs to the producer and is never touched by Swap, so locking it does nothing.
+///
+/// \param  aBuffer Get or Set buffer
+///
+/// \author David Levy
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void
+LdRingBuffer::Lock( eBuffer aBuffer )
+{
+    if( aBuffer != B_GET )
+        return;
+
+    size_t lSlot = AcquireLatest();
+
+    for( ;; )
+    {
+        uint32_t lCount = mLockCount.load();
+
+        if( lCount == 0 )
+        {
+            //First lock: publish our slot. Another consumer may be in UnLock, wait for it to clear the locked slot.
+            size_t lExpected = INVALID_SLOT;
+
+            if( mLockedSlot.compare_exchange_strong( lExpected, lSlot ) )
+            {
+                mLockCount.store( 1 );
+                return;
+            }
+        }
+        else if( mLockCount.compare_exchange_strong( lCount, lCount + 1 ) )
+        {
+            //Already locked by another consumer, share its frame
+            Release( lSlot );
+            return;
+        }
+
+        LeddarUtils::LtTimeUtils::WaitBlockingMicro( 1 );
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LdRingBuffer::UnLock( eBuffer aBuffer )
+///
+/// \brief  Unlock the get buffer. Does nothing if the buffer is not locked.
+///
+/// \param  aBuffer Get or Set buffer
+///
+/// \author David Levy
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void
+LdRingBuffer::UnLock( eBuffer aBuffer )
+{
+    if( aBuffer != B_GET )
+        return;
+
+    for( ;; )
+    {
+        uint32_t lCount = mLockCount.load();
+
+        if( lCount == 0 )
+            return;
+
+        if( lCount == 1 )
+        {
+            //Last lock. Read the slot before releasing the count so a new Lock cannot replace it under us
+            size_t lSlot = mLockedSlot.load();
+
+            if( lSlot != INVALID_SLOT && mLockCount.compare_exchange_strong( lCount, 0 ) )
+            {
+                mLockedSlot.store( INVALID_SLOT );
+                Release( lSlot );
+                return;
+            }
+        }
+        else if( mLockCount.compare_exchange_strong( lCount, lCount - 1 ) )
+        {
+            return;
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn size_t LdRingBuffer::AcquireLatest( void )
+///
+/// \brief  Pin the latest published frame. The producer will not reuse the slot until Release is called.
+///
+/// \return The pinned slot index.
+///
+/// \author David Levy
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+size_t
+LdRingBuffer::AcquireLatest( void )
+{
+    if( mSlots == nullptr )
+        throw std::logic_error( "Buffers not initialized" );
+
+    for( ;; )
+    {
+        size_t lSlot = mLatestSlot.load();
+        mSlots[lSlot].mReaders.fetch_add( 1 );
+
+        //The producer may have published another frame and started to reuse this slot before we pinned it
+        if( mLatestSlot.load() == lSlot )
+            return lSlot;
+
+        mSlots[lSlot].mReaders.fetch_sub( 1 );
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LdRingBuffer::Retain( size_t aSlot )
+///
+/// \brief  Pin again a slot already pinned by the caller (to share it). Each Retain needs a Release.
+///
+/// \param  aSlot   The slot index.
+///
+/// \author David Levy
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void
+LdRingBuffer::Retain( size_t aSlot )
+{
+    if( aSlot >= mSlotCount )
+        throw std::out_of_range( "Invalid slot index" );
+
+    mSlots[aSlot].mReaders.fetch_add( 1 );
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LdRingBuffer::Release( size_t aSlot )
+///
+/// \brief  Release a slot pinned by AcquireLatest.
+///
+/// \param  aSlot   The slot index.
+///
+/// \author David Levy
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void
+LdRingBuffer::Release( size_t aSlot )
+{
+    if( aSlot >= mSlotCount )
+        throw std::out_of_range( "Invalid slot index" );
+
+    mSlots[aSlot].mReaders.fetch_sub( 1 );
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn size_t LdRingBuffer::GetSlotIndex( const void *aBuffer ) const
+///
+/// \brief  Gets the slot index of a data buffer.
+///
+/// \param  aBuffer The data buffer (DataBuffer::mBuffer).
+///
+/// \return The slot index, INVALID_SLOT if the buffer does not belong to the ring.
+///
+/// \author David Levy
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+size_t
+LdRingBuffer::GetSlotIndex( const void *aBuffer ) const
+{
+    for( size_t i = 0; i < mSlotCount; ++i )
+    {
+        if( mSlots[i].mData.mBuffer == aBuffer )
+            return i;
+    }
+
+    return INVALID_SLOT;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn uint32_t LdRingBuffer::GetTimestamp( eBuffer aBuffer ) const
+///
+/// \brief  Get the timestamp of the buffer
+///
+/// \param  aBuffer Get or Set buffer
+///
+/// \author David Levy
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+uint32_t
+LdRingBuffer::GetTimestamp( eBuffer aBuffer ) const
+{
+    return mSlots[GetSlot( aBuffer )].mTimestamp;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LdRingBuffer::SetTimestamp( uint32_t aTimestamp )
+///
+/// \brief  Sets the timestamp of the set buffer
+///
+/// \param  aTimestamp  The new timestamp.
+///
+/// \author David Levy
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void
+LdRingBuffer::SetTimestamp( uint32_t aTimestamp )
+{
+    mSlots[mSetSlot].mTimestamp = aTimestamp;
+
+    if( mTimestamp && mTimestamp->Count() < 2 )
+    {
+        mTimestamp->ForceValue( 0, aTimestamp );
+    }
+    else if( mTimestamp )
+    {
+        mTimestamp->ForceValue( 1, aTimestamp );
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn uint64_t LdRingBuffer::GetSequence( eBuffer aBuffer ) const
+///
+/// \brief  Get the sequence number of the buffer. Consecutive frames have consecutive numbers, so a consumer can detect the frames it missed.
+///
+/// \param  aBuffer Get or Set buffer
+///
+/// \author David Levy
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+uint64_t
+LdRingBuffer::GetSequence( eBuffer aBuffer ) const
+{
+    return aBuffer == B_GET ? mSlots[GetSlot( B_GET )].mSequence : mSequence + 1;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn size_t LdRingBuffer::GetSlot( eBuffer aBuffer ) const
+///
+/// \brief  Gets the slot index of the get or set buffer
+///
+/// \param  aBuffer Get or Set buffer
+///
+/// \author David Levy
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+size_t
+LdRingBuffer::GetSlot( eBuffer aBuffer ) const
+{
+    if( mSlots == nullptr )
+        throw std::logic_error( "Buffers not initialized" );
+
+    if( aBuffer == B_SET )
+        return mSetSlot;
+
+    size_t lLocked = mLockedSlot.load();
+    return lLocked != INVALID_SLOT ? lLocked : mLatestSlot.load();
+}
@@ -0,0 +1,94 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \file   Leddar/LdRingBuffer.h
+///
+/// \brief  Declares the LdRingBuffer class.
+///     Lock-free ring of N pre-allocated frame buffers, written by a single producer (the acquisition thread)
+///     and read by any number of consumers. Every published frame gets a sequence number.
+///     As with LdDoubleBuffer, the class that instantiate it owns the actual data buffers (DataBuffer::mBuffer).
+///
+/// Copyright (c) 2018 LeddarTech. All rights reserved.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "LtDefines.h"
+#include "LdDoubleBuffer.h"
+#include "LdIntegerProperty.h"
+
+#include <atomic>
+#include <vector>
+
+namespace LeddarConnection
+{
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \class  LdRingBuffer
+    ///
+    /// \brief  Single producer / multiple consumers frame ring.
+    ///
+    ///         The producer always writes in the B_SET slot and publishes it with Swap(). Swap never overwrites the latest
+    ///         published frame nor a frame pinned by a consumer, so a consumer can hold a frame (AcquireLatest / Release)
+    ///         without blocking the producer. At most GetSlotCount() - 2 frames can be retained at the same time:
+    ///         beyond that the producer drops the new frames (GetDroppedCount) until a frame is released.
+    ///         The legacy Lock / UnLock( B_GET ) pair pins the latest frame and freezes the B_GET view until UnLock.
+    ///
+    /// \author David Levy
+    /// \date   October 2026
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    class LdRingBuffer
+    {
+    public:
+        static const size_t INVALID_SLOT = static_cast<size_t>( -1 );
+
+        LdRingBuffer();
+        ~LdRingBuffer();
+        void Init( const std::vector<void *> &aBuffers, LeddarCore::LdIntegerProperty *aTimestamp = nullptr );
+
+        void Swap();
+        void Lock( eBuffer aBuffer );
+        void UnLock( eBuffer aBuffer );
+
+        uint32_t    GetTimestamp( eBuffer aBuffer = B_GET ) const;
+        void        SetTimestamp( uint32_t aTimestamp );
+        uint64_t    GetSequence( eBuffer aBuffer = B_GET ) const;
+
+        DataBuffer *GetBuffer( eBuffer aBuffer ) { return &mSlots[GetSlot( aBuffer )].mData; }
+        const DataBuffer *GetConstBuffer( eBuffer aBuffer ) const { return &mSlots[GetSlot( aBuffer )].mData; }
+
+        //Lock-free consumer access
+        size_t      AcquireLatest( void );
+        void        Retain( size_t aSlot );
+        void        Release( size_t aSlot );
+        size_t      GetSlotCount( void ) const { return mSlotCount; }
+        uint64_t    GetDroppedCount( void ) const { return mDroppedCount; }
+        size_t      GetSlotIndex( const void *aBuffer ) const;
+        const DataBuffer *GetSlotBuffer( size_t aSlot ) const { return &mSlots[aSlot].mData; }
+        uint32_t    GetSlotTimestamp( size_t aSlot ) const { return mSlots[aSlot].mTimestamp; }
+        uint64_t    GetSlotSequence( size_t aSlot ) const { return mSlots[aSlot].mSequence; }
+
+    private:
+        LdRingBuffer( const LdRingBuffer &aBuffer ); //Disable copy constructor
+        LdRingBuffer &operator=( const LdRingBuffer &aBuffer ); //Disable equal operator
+
+        struct sSlot
+        {
+            sSlot() : mReaders( 0 ), mSequence( 0 ), mTimestamp( 0 ) {}
+            DataBuffer              mData;
+            std::atomic<uint32_t>   mReaders;   ///< Number of consumers that pinned this slot
+            uint64_t                mSequence;  ///< Sequence number of the frame, written by the producer before publication
+            uint32_t                mTimestamp; ///< Sensor timestamp of the frame
+        };
+
+        size_t GetSlot( eBuffer aBuffer ) const;
+        size_t FindFreeSlot( size_t aLatest ) const;
+
+        LeddarCore::LdIntegerProperty *mTimestamp; //Mirror of the timestamps. Value 0 is the latest published frame, 1 is the frame being written
+        sSlot                  *mSlots;
+        size_t                  mSlotCount;
+        size_t                  mSetSlot;       ///< Slot owned by the producer
+        uint64_t                mSequence;      ///< Last published sequence number
+        std::atomic<uint64_t>   mDroppedCount;  ///< Frames not published because the consumers retained every free slot
+        std::atomic<size_t>     mLatestSlot;    ///< Latest published slot
+        std::atomic<size_t>     mLockedSlot;    ///< Slot pinned by the legacy Lock( B_GET )
+        std::atomic<uint32_t>   mLockCount;     ///< Number of legacy Lock( B_GET ) on mLockedSlot
+    };
+}
@@ -41,6 +41,17 @@ LdSensor::LdSensor( LeddarConnection::LdConnection *aConnection, LeddarCore::LdP
     mDataMask( 0 )
 {
     InitProperties();
+
+#ifdef BUILD_TIMING_STATS
+
+    if( aConnection != nullptr )
+    {
+        aConnection->SetTimingStats( &mTimingStats );
+    }
+
+    mEchoes.SetTimingStats( &mTimingStats );
+    mStates.SetTimingStats( &mTimingStats );
+#endif
 }
 
 // *****************************************************************************
@@ -54,6 +65,14 @@ LdSensor::LdSensor( LeddarConnection::LdConnection *aConnection, LeddarCore::LdP
 // *****************************************************************************
 LdSensor::~LdSensor()
 {
+#ifdef BUILD_TIMING_STATS
+
+    if( GetConnection() != nullptr )
+    {
+        GetConnection()->SetTimingStats( nullptr );
+    }
+
+#endif
 }
 
 // *****************************************************************************
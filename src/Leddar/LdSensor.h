@@ -63,6 +63,9 @@ namespace LeddarDevice
         virtual void                        Reset( LeddarDefines::eResetType aType, LeddarDefines::eResetOptions aOptions = LeddarDefines::RO_NO_OPTION ) = 0;
         LeddarConnection::LdResultEchoes   *GetResultEchoes( void ) { return &mEchoes; }
         LeddarConnection::LdResultStates   *GetResultStates( void ) { return &mStates; }
+#ifdef BUILD_TIMING_STATS
+        LeddarConnection::LdTimingStats    *GetTimingStats( void ) { return &mTimingStats; }
+#endif
 
         virtual void                        SetDataMask( uint32_t aDataMask ) { mDataMask = aDataMask; }
 
@@ -75,6 +78,9 @@ namespace LeddarDevice
         LdSensor( LeddarConnection::LdConnection *aConnection, LeddarCore::LdPropertiesContainer *aProperties = nullptr );
         LeddarConnection::LdResultEchoes mEchoes;
         LeddarConnection::LdResultStates mStates;
+#ifdef BUILD_TIMING_STATS
+        LeddarConnection::LdTimingStats mTimingStats;
+#endif
 
         static uint32_t  GetDataMaskAll( void ) { return DM_ALL; }
         virtual uint32_t ConvertDataMaskToLTDataMask( uint32_t aMask );
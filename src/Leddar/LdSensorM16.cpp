@@ -30,6 +30,30 @@
 
 using namespace LeddarCore;
 
+namespace
+{
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn void CopyToColumn( const LeddarConnection::LdElementView &aView, std::vector<T> &aColumn )
+    ///
+    /// \brief  Copies the values of an element to an echo column in one block.
+    ///
+    /// \exception  LeddarException::LtComException Thrown if the element does not fit in the column.
+    ///
+    /// \author David Levy
+    /// \date   October 2026
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    template<typename T>
+    void CopyToColumn( const LeddarConnection::LdElementView &aView, std::vector<T> &aColumn )
+    {
+        if( aView.Size() != sizeof( T ) || aView.Count() > aColumn.size() )
+        {
+            throw LeddarException::LtComException( "Unable to copy the element in the echo column, count or size do not match." );
+        }
+
+        aView.CopyTo( aColumn.data(), sizeof( T ) );
+    }
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// \fn LeddarDevice::LdSensorM16::LdSensorM16( LeddarConnection::LdConnection *aConnection )
 ///
@@ -43,12 +67,18 @@ using namespace LeddarCore;
 LeddarDevice::LdSensorM16::LdSensorM16( LeddarConnection::LdConnection *aConnection ):
     LdSensor( aConnection ),
     mProtocolConfig( nullptr ),
-    mProtocolData( nullptr )
+    mProtocolData( nullptr ),
+    mCpuLoadPeriodMs( 1000 ),
+    mLastCpuLoadRequest( 0 )
 {
     if( aConnection )
     {
         mProtocolConfig = dynamic_cast<LeddarConnection::LdProtocolLeddartechUSB *>( aConnection );
         mProtocolData = new LeddarConnection::LdProtocolLeddartechUSB( mProtocolConfig->GetConnectionInfo(), mProtocolConfig, LeddarConnection::LdProtocolLeddartechUSB::EP_DATA );
+        mProtocolData->ShareTransportCounters( mProtocolConfig );
+#ifdef BUILD_TIMING_STATS
+        mProtocolData->SetTimingStats( &mTimingStats );
+#endif
     }
 
     mResultStatePropeties = GetResultStates()->GetProperties();
@@ -408,6 +438,7 @@ LeddarDevice::LdSensorM16::GetConfig( void )
 /// \fn void LeddarDevice::LdSensorM16::SetConfig( void )
 ///
 /// \brief  Sets the configuration to the device
+///         Only the modified properties are sent, in as few requests as possible. Nothing is sent if none is modified.
 ///
 /// \author Patrick Boulay
 /// \date   March 2017
@@ -415,28 +446,22 @@ LeddarDevice::LdSensorM16::GetConfig( void )
 void
 LeddarDevice::LdSensorM16::SetConfig( void )
 {
-    mProtocolConfig->StartRequest( LtComLeddarTechPublic::LT_COMM_CFGSRV_REQUEST_SET_CONFIG );
-
     std::vector<LeddarCore::LdProperty *> lProperties = mProperties->FindPropertiesByCategories( LeddarCore::LdProperty::CAT_CONFIGURATION );
+    std::vector<LeddarCore::LdProperty *> lModified;
 
     for( std::vector<LeddarCore::LdProperty *>::iterator lIter = lProperties.begin(); lIter != lProperties.end(); ++lIter )
     {
         if( ( *lIter )->Modified() )
         {
-            mProtocolConfig->AddElement( ( *lIter )->GetDeviceId(), static_cast<uint16_t>( ( *lIter )->Count() ), ( *lIter )->UnitSize(), ( *lIter )->CStorage(),
-                                         static_cast<uint32_t>( ( *lIter )->Stride() ) );
+            lModified.push_back( *lIter );
         }
     }
 
-    mProtocolConfig->SendRequest();
-    mProtocolConfig->ReadAnswer();
+    mProtocolConfig->SendProperties( LtComLeddarTechPublic::LT_COMM_CFGSRV_REQUEST_SET_CONFIG, lModified );
 
-    for( std::vector<LeddarCore::LdProperty *>::iterator lIter = lProperties.begin(); lIter != lProperties.end(); ++lIter )
+    for( std::vector<LeddarCore::LdProperty *>::iterator lIter = lModified.begin(); lIter != lModified.end(); ++lIter )
     {
-        if( ( *lIter )->Modified() )
-        {
-            ( *lIter )->SetClean();
-        }
+        ( *lIter )->SetClean();
     }
 }
 
@@ -800,25 +825,49 @@ LeddarDevice::LdSensorM16::GetData( void )
     }
     catch( LeddarException::LtTimeoutException & )
     {
+        ++mProtocolData->GetTransportCounters().mTimeouts;
         return false;
     }
 
+    uint64_t lHostTimestamp = LeddarUtils::LtTimeUtils::GetMonotonicNanoseconds();
     uint16_t lRequestCode = mProtocolData->GetRequestCode();
 
     //Return true only on states because they are received last for a frame, and they hold the timestamp (trace and echo dont know the timestamp by themselves)
     if( lRequestCode == LtComLeddarTechPublic::LT_COMM_DATASRV_REQUEST_SEND_ECHOES )
     {
+        mEchoes.SetHostTimestamp( lHostTimestamp );
+        LT_TIMING_BEGIN( lStart );
         ProcessEchoes();
+        LT_TIMING_END( &mTimingStats, TS_DECODE, lStart );
         return false;
     }
     else if( lRequestCode == LtComLeddarTechPublic::LT_COMM_DATASRV_REQUEST_SEND_STATES )
     {
+        mStates.SetHostTimestamp( lHostTimestamp );
         return ProcessStates();
     }
 
     return false;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LeddarDevice::LdSensorM16::SetAsyncDataRead( bool aEnable, size_t aTransferCount )
+///
+/// \brief  Keeps USB transfers queued on the data endpoint so the sensor never waits for GetData to send a frame.
+///         Use it at high frame rates. The sensor must be connected. Disconnect stops it.
+///
+/// \param  aEnable         True to start, false to stop.
+/// \param  aTransferCount  Number of queued transfers (frames buffered while GetData is not called).
+///
+/// \author David Levy
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void
+LeddarDevice::LdSensorM16::SetAsyncDataRead( bool aEnable, size_t aTransferCount )
+{
+    mProtocolData->SetAsyncRead( aEnable, aTransferCount );
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// \fn bool LeddarDevice::LdSensorM16::ProcessStates( void )
 ///
@@ -833,7 +882,9 @@ bool
 LeddarDevice::LdSensorM16::ProcessStates( void )
 {
     uint32_t lPreviousTimeStamp = mStates.GetTimestamp();
+    LT_TIMING_BEGIN( lStart );
     mProtocolData->ReadElementToProperties( mResultStatePropeties );
+    LT_TIMING_END( &mTimingStats, TS_DECODE, lStart );
 
     if( lPreviousTimeStamp != mStates.GetTimestamp() )
     {
@@ -846,8 +897,16 @@ LeddarDevice::LdSensorM16::ProcessStates( void )
             mEchoes.UpdateFinished();
         }
 
-        //And Finally Get specific data from sensor
-        RequestProperties( GetResultStates()->GetProperties(), std::vector<uint16_t>( 1, LtComLeddarTechPublic::LT_COMM_ID_CPU_LOAD_V2 ) );
+        //And Finally Get specific data from sensor. The CPU load request is a round trip on the config channel,
+        //so it is refreshed every mCpuLoadPeriodMs (SetCpuLoadPeriod) instead of every frame
+        uint64_t lNow = LeddarUtils::LtTimeUtils::GetMonotonicNanoseconds();
+
+        if( mLastCpuLoadRequest == 0 || lNow - mLastCpuLoadRequest >= static_cast<uint64_t>( mCpuLoadPeriodMs ) * 1000000 )
+        {
+            RequestProperties( GetResultStates()->GetProperties(), std::vector<uint16_t>( 1, LtComLeddarTechPublic::LT_COMM_ID_CPU_LOAD_V2 ) );
+            mLastCpuLoadRequest = lNow;
+        }
+
         mStates.UpdateFinished();
         return true;
     }
@@ -876,6 +935,12 @@ LeddarDevice::LdSensorM16::ProcessEchoes( void )
     std::vector<LeddarConnection::LdEcho> &lEchoes = *mEchoes.GetEchoes( LeddarConnection::B_SET );
     mEchoes.Lock( LeddarConnection::B_SET );
 
+    if( mEchoes.IsColumnLayout() )
+    {
+        ProcessEchoesToColumns();
+        return;
+    }
+
     while( mProtocolData->ReadElement() )
     {
         switch( mProtocolData->GetElementId() )
@@ -925,6 +990,55 @@ LeddarDevice::LdSensorM16::ProcessEchoes( void )
     //We do not swap nor send the UpdateFinished signal here, the timestamp is only in the states so we need to wait for the states
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LeddarDevice::LdSensorM16::ProcessEchoesToColumns( void )
+///
+/// \brief  Process the echoes read by GetData with the column layout: each element is copied in one block in its column
+///
+/// \author David Levy
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void
+LeddarDevice::LdSensorM16::ProcessEchoesToColumns( void )
+{
+    LeddarConnection::EchoColumns &lColumns = *mEchoes.GetColumns( LeddarConnection::B_SET );
+    LeddarConnection::LdElementView lView;
+
+    //The values are copied in one block from the receive buffer to their column
+    while( mProtocolData->ReadElementView( lView ) )
+    {
+        switch( lView.Id() )
+        {
+            case LtComLeddarTechPublic::LT_COMM_ID_ECHOES_AMPLITUDE:
+                mEchoes.SetEchoCount( lView.Count() );
+                CopyToColumn( lView, lColumns.mAmplitudes );
+                break;
+
+            case LtComLeddarTechPublic::LT_COMM_ID_ECHOES_DISTANCE:
+                mEchoes.SetEchoCount( lView.Count() );
+                CopyToColumn( lView, lColumns.mDistances );
+                break;
+
+            case LtComLeddarTechPublic::LT_COMM_ID_ECHOES_BASE:
+                mEchoes.SetEchoCount( lView.Count() );
+                CopyToColumn( lView, lColumns.mBases );
+                break;
+
+            case LtComLeddarTechPublic::LT_COMM_ID_ECHOES_CHANNEL_INDEX:
+                mEchoes.SetEchoCount( lView.Count() );
+                CopyToColumn( lView, lColumns.mChannelIndexes );
+                break;
+
+            case LtComLeddarTechPublic::LT_COMM_ID_ECHOES_VALID:
+                mEchoes.SetEchoCount( lView.Count() );
+                CopyToColumn( lView, lColumns.mFlags );
+                break;
+        }
+    }
+
+    //We do not swap nor send the UpdateFinished signal here, the timestamp is only in the states so we need to wait for the states
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// \fn void LeddarDevice::LdSensorM16::Reset( LeddarDefines::eResetType aType, LeddarDefines::eResetOptions aOptions )
 ///
@@ -1005,7 +1119,7 @@ LeddarDevice::LdSensorM16::RequestProperties( LeddarCore::LdPropertiesContainer
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// \fn void LeddarDevice::LdSensorM16::SetProperties( LeddarCore::LdPropertiesContainer *aProperties, std::vector<uint16_t> aDeviceIds, unsigned int aRetryNbr )
 ///
-/// \brief  Sets the properties
+/// \brief  Sets the properties, in as few requests as possible
 ///
 /// \exception  LeddarException::LtComException Thrown when a Lt Com error condition occurs.
 ///
@@ -1019,39 +1133,19 @@ LeddarDevice::LdSensorM16::RequestProperties( LeddarCore::LdPropertiesContainer
 void
 LeddarDevice::LdSensorM16::SetProperties( LeddarCore::LdPropertiesContainer *aProperties, std::vector<uint16_t> aDeviceIds, unsigned int aRetryNbr )
 {
+    std::vector<LeddarCore::LdProperty *> lProperties;
+
     for( size_t i = 0; i < aDeviceIds.size(); ++i )
     {
         LeddarCore::LdProperty *lProperty = aProperties->FindDeviceProperty( aDeviceIds[ i ] );
 
         if( lProperty != nullptr )
         {
-            mProtocolConfig->StartRequest( LtComLeddarTechPublic::LT_COMM_CFGSRV_REQUEST_SET );
-            mProtocolConfig->AddElement( aDeviceIds[ i ], static_cast<uint16_t>( lProperty->Count() ), lProperty->UnitSize(), lProperty->CStorage(),
-                                         static_cast<uint32_t>( lProperty->Stride() ) );
-            mProtocolConfig->SendRequest();
-
-            unsigned int lCount = aRetryNbr;
-            bool lRetry = false;
-
-            do
-            {
-                try
-                {
-                    lRetry = false;
-                    mProtocolConfig->ReadAnswer();
-                }
-                catch( LeddarException::LtComException &e )
-                {
-                    if( e.GetDisconnect() == true )
-                        throw;
-
-                    ( lCount-- != 0 ) ? lRetry = true : throw;
-
-                }
-            }
-            while( lRetry );
+            lProperties.push_back( lProperty );
         }
     }
+
+    mProtocolConfig->SendProperties( LtComLeddarTechPublic::LT_COMM_CFGSRV_REQUEST_SET, lProperties, aRetryNbr );
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
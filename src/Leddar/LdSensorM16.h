@@ -36,6 +36,9 @@ namespace LeddarDevice
         virtual bool GetData( void ) override;
         virtual bool GetEchoes( void ) override { return false; }; //Dont use this function, use GetData
         virtual void GetStates( void ) override {}; //Dont use this function, use GetData
+        void         SetAsyncDataRead( bool aEnable, size_t aTransferCount = 4 );
+        void         SetCpuLoadPeriod( uint32_t aPeriodMs ) { mCpuLoadPeriodMs = aPeriodMs; }
+        uint32_t     GetCpuLoadPeriod( void ) const { return mCpuLoadPeriodMs; }
 
         virtual void    Reset( LeddarDefines::eResetType aType, LeddarDefines::eResetOptions aOptions = LeddarDefines::RO_NO_OPTION ) override;
         void            RequestProperties( LeddarCore::LdPropertiesContainer *aProperties, std::vector<uint16_t> aDeviceIds );
@@ -54,9 +57,12 @@ namespace LeddarDevice
         LeddarConnection::LdProtocolLeddartechUSB    *mProtocolConfig;
         LeddarConnection::LdProtocolLeddartechUSB    *mProtocolData;
         LeddarCore::LdPropertiesContainer            *mResultStatePropeties;
+        uint32_t                                     mCpuLoadPeriodMs;       ///< Minimum time between two CPU load requests, 0 to request it with every states
+        uint64_t                                     mLastCpuLoadRequest;    ///< Time of the last CPU load request (monotonic ns), 0 if none
 
         virtual bool    ProcessStates( void );
         void            ProcessEchoes( void );
+        void            ProcessEchoesToColumns( void );
 
     private:
         LdSensorM16( const LdSensorM16 &aSensor ); //Disable copy constructor
@@ -675,7 +675,7 @@ bool LeddarDevice::LdSensorM16Can::GetEchoes( void )
             if( !mProtocol->ReadDetectionAnswer() )
             {
                 --lTimeout;
-                LeddarUtils::LtTimeUtils::Wait( 1 );
+                mProtocol->WaitForData( 1 );
                 continue;
             }
 
@@ -729,6 +729,7 @@ bool LeddarDevice::LdSensorM16Can::GetEchoes( void )
     }
 
     mEchoes.SetCurrentLedPower( lCrurrentLedPower );
+    mEchoes.SetHostTimestamp( mProtocol->GetDetectionTimestamp() ); //Reception time of the last frame of the echo set
     mEchoes.SetTimestamp( lTimestamp );
     mEchoes.UnLock( LeddarConnection::B_SET );
 
@@ -762,6 +763,7 @@ void LeddarDevice::LdSensorM16Can::GetStates( void )
     uint16_t lRawTemp = *reinterpret_cast<uint32_t *>( &lConfigData.mFrame.Cmd.mArg[2] );
     GetResultStates()->GetProperties()->GetFloatProperty( LeddarCore::LdPropertyIds::ID_RS_SYSTEM_TEMP )->ForceRawValue( 0, lRawTemp );
 
+    GetResultStates()->SetHostTimestamp( mEchoes.GetHostTimestamp( LeddarConnection::B_GET ) );
     GetResultStates()->SetTimestamp( mEchoes.GetTimestamp( LeddarConnection::B_GET ) ); //we use latest echo timestamp, better than nothing
     GetResultStates()->UpdateFinished();
 }
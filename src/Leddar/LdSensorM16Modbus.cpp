@@ -50,7 +50,7 @@ LdSensorM16Modbus::LdSensorM16Modbus( LeddarConnection::LdConnection *aConnectio
     if( aConnection != nullptr )
     {
         mConnectionInfoModbus = dynamic_cast< const LeddarConnection::LdConnectionInfoModbus * >( aConnection->GetConnectionInfo() );
-        mInterface = dynamic_cast< LeddarConnection::LdLibModbusSerial * >( aConnection );
+        mInterface = dynamic_cast< LeddarConnection::LdInterfaceModbus * >( aConnection );
     }
 
     InitProperties();
@@ -103,8 +103,6 @@ LdSensorM16Modbus::GetEchoes0x41( void )
     mInterface->SendRawRequest( lRawRequest, 2 );
     size_t lReceivedSize = mInterface->ReceiveRawConfirmationLT( lResponse, GetProperties()->GetIntegerProperty( LeddarCore::LdPropertyIds::ID_DEVICE_TYPE )->ValueT<uint16_t>() );
 
-    LeddarUtils::LtTimeUtils::WaitBlockingMicro( LtComLeddarM16Modbus::M16_WAIT_AFTER_REQUEST );
-
     if( lReceivedSize <= MODBUS_DATA_OFFSET )
     {
         mInterface->Flush();
@@ -174,8 +172,6 @@ LdSensorM16Modbus::GetEchoes0x6A( void )
     mInterface->SendRawRequest( lRawRequest, 2 );
     size_t lReceivedSize = mInterface->ReceiveRawConfirmationLT( lResponse, GetProperties()->GetIntegerProperty( LeddarCore::LdPropertyIds::ID_DEVICE_TYPE )->ValueT<uint16_t>() );
 
-    LeddarUtils::LtTimeUtils::WaitBlockingMicro( LtComLeddarM16Modbus::M16_WAIT_AFTER_REQUEST );
-
     if( lReceivedSize <= MODBUS_DATA_OFFSET )
     {
         mInterface->Flush();
@@ -237,7 +233,6 @@ LdSensorM16Modbus::GetStates( void )
 {
     uint16_t lResponse[LTMODBUS_RTU_MAX_ADU_LENGTH / 2] = { 0 };
     mInterface->ReadInputRegisters( 0, 1, lResponse );
-    LeddarUtils::LtTimeUtils::WaitBlockingMicro( LtComLeddarM16Modbus::M16_WAIT_AFTER_REQUEST );
 
     GetResultStates()->GetProperties()->GetFloatProperty( LeddarCore::LdPropertyIds::ID_RS_SYSTEM_TEMP )->ForceRawValue( 0, lResponse[0] );
 }
@@ -258,14 +253,12 @@ LdSensorM16Modbus::GetConfig( void )
     if( mInterface->GetDeviceType() == LtComLeddarTechPublic::LT_COMM_DEVICE_TYPE_IS16 )
     {
         mInterface->ReadRegisters( LtComLeddarM16Modbus::DID_REFRESH_RATE, 1, lResponse );
-        LeddarUtils::LtTimeUtils::WaitBlockingMicro( LtComLeddarM16Modbus::M16_WAIT_AFTER_REQUEST );
         GetProperties()->GetEnumProperty( LeddarCore::LdPropertyIds::ID_REFRESH_RATE )->SetValue( 0, lResponse[0] );
         GetProperties()->GetEnumProperty( LeddarCore::LdPropertyIds::ID_REFRESH_RATE )->SetClean();
     }
     else
     {
         mInterface->ReadRegisters( LtComLeddarM16Modbus::DID_ACCUMULATION_EXP, 3, lResponse );
-        LeddarUtils::LtTimeUtils::WaitBlockingMicro( LtComLeddarM16Modbus::M16_WAIT_AFTER_REQUEST );
         GetProperties()->GetIntegerProperty( LeddarCore::LdPropertyIds::ID_ACCUMULATION_EXP )->SetValue( 0, lResponse[0] );
         GetProperties()->GetIntegerProperty( LeddarCore::LdPropertyIds::ID_ACCUMULATION_EXP )->SetClean();
         GetProperties()->GetIntegerProperty( LeddarCore::LdPropertyIds::ID_OVERSAMPLING_EXP )->SetValue( 0, lResponse[1] );
@@ -278,7 +271,6 @@ LdSensorM16Modbus::GetConfig( void )
 
     memset( lResponse, 0, LTMODBUS_RTU_MAX_ADU_LENGTH );
     mInterface->ReadRegisters( LtComLeddarM16Modbus::DID_THRESHOLD_OFFSET, 5, lResponse );
-    LeddarUtils::LtTimeUtils::WaitBlockingMicro( LtComLeddarM16Modbus::M16_WAIT_AFTER_REQUEST );
     GetProperties()->GetFloatProperty( LeddarCore::LdPropertyIds::ID_SENSIVITY_OLD )->SetRawValue( 0, lResponse[0] );
     GetProperties()->GetFloatProperty( LeddarCore::LdPropertyIds::ID_SENSIVITY_OLD )->SetClean();
     GetProperties()->GetEnumProperty( LeddarCore::LdPropertyIds::ID_LED_INTENSITY )->SetValue( 0, lResponse[1] );
@@ -292,13 +284,11 @@ LdSensorM16Modbus::GetConfig( void )
 
     memset( lResponse, 0, LTMODBUS_RTU_MAX_ADU_LENGTH );
     mInterface->ReadRegisters( LtComLeddarM16Modbus::DID_PRECISION, 1, lResponse );
-    LeddarUtils::LtTimeUtils::WaitBlockingMicro( LtComLeddarM16Modbus::M16_WAIT_AFTER_REQUEST );
     GetProperties()->GetIntegerProperty( LeddarCore::LdPropertyIds::ID_PRECISION )->SetValue( 0, lResponse[0] );
     GetProperties()->GetIntegerProperty( LeddarCore::LdPropertyIds::ID_PRECISION )->SetClean();
 
     memset( lResponse, 0, LTMODBUS_RTU_MAX_ADU_LENGTH );
     mInterface->ReadRegisters( LtComLeddarM16Modbus::DID_COM_SERIAL_PORT_ECHOES_RES, 2, lResponse );
-    LeddarUtils::LtTimeUtils::WaitBlockingMicro( LtComLeddarM16Modbus::M16_WAIT_AFTER_REQUEST );
     GetProperties()->GetEnumProperty( LeddarCore::LdPropertyIds::ID_COM_SERIAL_PORT_ECHOES_RES )->SetValue( 0, lResponse[0] );
     GetProperties()->GetEnumProperty( LeddarCore::LdPropertyIds::ID_COM_SERIAL_PORT_ECHOES_RES )->SetClean();
     GetProperties()->GetBitProperty( LeddarCore::LdPropertyIds::ID_SEGMENT_ENABLE_COM )->SetValue( 0, lResponse[1] );
@@ -306,13 +296,11 @@ LdSensorM16Modbus::GetConfig( void )
 
     memset( lResponse, 0, LTMODBUS_RTU_MAX_ADU_LENGTH );
     mInterface->ReadRegisters( LtComLeddarM16Modbus::DID_SEGMENT_ENABLE_DEVICE, 1, lResponse );
-    LeddarUtils::LtTimeUtils::WaitBlockingMicro( LtComLeddarM16Modbus::M16_WAIT_AFTER_REQUEST );
     GetProperties()->GetBitProperty( LeddarCore::LdPropertyIds::ID_SEGMENT_ENABLE )->SetValue( 0, lResponse[0] );
     GetProperties()->GetBitProperty( LeddarCore::LdPropertyIds::ID_SEGMENT_ENABLE )->SetClean();
 
     memset( lResponse, 0, LTMODBUS_RTU_MAX_ADU_LENGTH );
     mInterface->ReadRegisters( LtComLeddarM16Modbus::DID_COM_SERIAL_PORT_STOP_BITS, 4, lResponse );
-    LeddarUtils::LtTimeUtils::WaitBlockingMicro( LtComLeddarM16Modbus::M16_WAIT_AFTER_REQUEST );
     GetProperties()->GetEnumProperty( LeddarCore::LdPropertyIds::ID_COM_SERIAL_PORT_STOP_BITS )->SetValue( 0, lResponse[0] );
     GetProperties()->GetEnumProperty( LeddarCore::LdPropertyIds::ID_COM_SERIAL_PORT_STOP_BITS )->SetClean();
     GetProperties()->GetEnumProperty( LeddarCore::LdPropertyIds::ID_COM_SERIAL_PORT_PARITY )->SetValue( 0, lResponse[1] );
@@ -399,7 +387,6 @@ LdSensorM16Modbus::SetConfig( void )
 
             mInterface->WriteRegister( ( *lPropertyIter )->GetDeviceId(), lValue );
             ( *lPropertyIter )->SetClean();
-            LeddarUtils::LtTimeUtils::WaitBlockingMicro( LtComLeddarM16Modbus::M16_WAIT_AFTER_REQUEST );
         }
     }
 }
@@ -433,7 +420,6 @@ LdSensorM16Modbus::GetConstants( void )
 
     mInterface->SendRawRequest( lRawRequest, 2 );
     size_t lReceivedSize = mInterface->ReceiveRawConfirmation( lResponse, 0 );
-    LeddarUtils::LtTimeUtils::WaitBlockingMicro( LtComLeddarM16Modbus::M16_WAIT_AFTER_REQUEST );
 
     if( lReceivedSize <= MODBUS_DATA_OFFSET )
     {
@@ -20,7 +20,7 @@
 #include "LdSensor.h"
 #include "LdConnectionInfoModbus.h"
 
-#include "LdLibModbusSerial.h"
+#include "LdInterfaceModbus.h"
 
 namespace LeddarDevice
 {
@@ -43,7 +43,7 @@ namespace LeddarDevice
 
     protected:
         const LeddarConnection::LdConnectionInfoModbus  *mConnectionInfoModbus;
-        LeddarConnection::LdLibModbusSerial *mInterface;
+        LeddarConnection::LdInterfaceModbus *mInterface;
 
     private:
         void    InitProperties( void );
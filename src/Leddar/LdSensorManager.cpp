@@ -0,0 +1,588 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \file   Leddar/LdSensorManager.cpp
+///
+/// \brief  Implements the LdSensorManager class
+///
+/// Copyright (c) 2018 LeddarTech. All rights reserved.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "LdSensorManager.h"
+
+#include <stdexcept>
+
+namespace
+{
+    void ClearStats( LeddarDevice::LdSensorManager::sSensorStats &aStats )
+    {
+        aStats.mPollCount = 0;
+        aStats.mFrameCount = 0;
+        aStats.mErrorCount = 0;
+        aStats.mOverrunCount = 0;
+        aStats.mStealCount = 0;
+        aStats.mFps = 0;
+        aStats.mLastDurationUs = 0;
+        aStats.mMaxDurationUs = 0;
+        aStats.mLastError.clear();
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn LeddarDevice::LdSensorManager::LdSensorManager( size_t aWorkerCount )
+///
+/// \brief  Constructor. The workers are started by Start.
+///
+/// \exception  std::invalid_argument   Thrown if the worker count is 0.
+///
+/// \param  aWorkerCount    Number of worker threads.
+///
+/// \author David Levy
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+LeddarDevice::LdSensorManager::LdSensorManager( size_t aWorkerCount ) :
+    mWorkerCount( aWorkerCount ),
+    mNextHome( 0 ),
+    mWorkerBusy( aWorkerCount, false ),
+    mStop( false )
+{
+    if( aWorkerCount == 0 )
+    {
+        throw std::invalid_argument( "Invalid worker count." );
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn LeddarDevice::LdSensorManager::~LdSensorManager()
+///
+/// \brief  Destructor. Stops the workers and deletes the owned sensors.
+///
+/// \author David Levy
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+LeddarDevice::LdSensorManager::~LdSensorManager()
+{
+    Stop();
+
+    for( size_t i = 0; i < mEntries.size(); ++i )
+    {
+        if( mEntries[i]->mOwned )
+            delete mEntries[i]->mSensor;
+
+        delete mEntries[i];
+    }
+
+    mEntries.clear();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LeddarDevice::LdSensorManager::AddSensor( LdSensor *aSensor, uint32_t aPeriodMs, bool aOwned )
+///
+/// \brief  Adds a connected sensor. It is polled as soon as a worker is available.
+///
+/// \exception  std::invalid_argument   Thrown if the sensor is null or already added.
+///
+/// \param [in] aSensor     The sensor. If it shares its transport with a sensor already added, it gets the same home worker.
+/// \param      aPeriodMs   Polling period, 0 to poll continuously.
+/// \param      aOwned      If true, the manager deletes the sensor when it is removed or when the manager is deleted.
+///
+/// \author David Levy
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void
+LeddarDevice::LdSensorManager::AddSensor( LdSensor *aSensor, uint32_t aPeriodMs, bool aOwned )
+{
+    if( aSensor == nullptr )
+    {
+        throw std::invalid_argument( "Invalid sensor." );
+    }
+
+    std::unique_lock<std::mutex> lLock( mMutex );
+
+    if( FindLocked( aSensor ) != nullptr )
+    {
+        throw std::invalid_argument( "Sensor already added." );
+    }
+
+    const void *lTransport = aSensor->GetConnection() != nullptr ? aSensor->GetConnection()->GetTransportKey() : aSensor;
+    size_t lHome = mWorkerCount;
+
+    for( size_t i = 0; i < mEntries.size() && lHome == mWorkerCount; ++i )
+    {
+        if( mEntries[i]->mTransport == lTransport )
+            lHome = mEntries[i]->mHome;
+    }
+
+    if( lHome == mWorkerCount )
+    {
+        lHome = mNextHome;
+        mNextHome = ( mNextHome + 1 ) % mWorkerCount;
+    }
+
+    sEntry *lEntry = new sEntry;
+    lEntry->mSensor = aSensor;
+    lEntry->mTransport = lTransport;
+    lEntry->mOwned = aOwned;
+    lEntry->mPeriod = std::chrono::milliseconds( aPeriodMs );
+    lEntry->mDue = Clock::now();
+    lEntry->mHome = lHome;
+    lEntry->mBusy = false;
+    lEntry->mRemoved = false;
+    ClearStats( lEntry->mStats );
+    lEntry->mFpsStart = lEntry->mDue;
+    lEntry->mFpsFrames = 0;
+
+    mEntries.push_back( lEntry );
+    lLock.unlock();
+    mCondition.notify_all();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LeddarDevice::LdSensorManager::RemoveSensor( LdSensor *aSensor )
+///
+/// \brief  Removes a sensor, waiting for its poll in progress. Deletes the sensor if it is owned.
+///
+/// \exception  std::invalid_argument   Thrown if the sensor was not added.
+/// \exception  std::logic_error        Thrown if called from a worker thread (a signal handler of a sensor), it could wait for itself.
+///
+/// \param [in] aSensor The sensor.
+///
+/// \author David Levy
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void
+LeddarDevice::LdSensorManager::RemoveSensor( LdSensor *aSensor )
+{
+    std::unique_lock<std::mutex> lLock( mMutex );
+
+    if( IsWorkerLocked() )
+    {
+        throw std::logic_error( "RemoveSensor cannot be called from a sensor signal handler." );
+    }
+
+    sEntry *lEntry = FindLocked( aSensor );
+
+    if( lEntry == nullptr )
+    {
+        throw std::invalid_argument( "Sensor not found." );
+    }
+
+    lEntry->mRemoved = true;
+    mCondition.wait( lLock, [lEntry] { return !lEntry->mBusy; } );
+
+    for( size_t i = 0; i < mEntries.size(); ++i )
+    {
+        if( mEntries[i] == lEntry )
+        {
+            mEntries.erase( mEntries.begin() + i );
+            break;
+        }
+    }
+
+    lLock.unlock();
+
+    if( lEntry->mOwned )
+        delete lEntry->mSensor;
+
+    delete lEntry;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LeddarDevice::LdSensorManager::SetPeriod( LdSensor *aSensor, uint32_t aPeriodMs )
+///
+/// \brief  Changes the polling period of a sensor. Applies from its next poll.
+///
+/// \exception  std::invalid_argument   Thrown if the sensor was not added.
+///
+/// \param [in] aSensor     The sensor.
+/// \param      aPeriodMs   Polling period, 0 to poll continuously.
+///
+/// \author David Levy
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void
+LeddarDevice::LdSensorManager::SetPeriod( LdSensor *aSensor, uint32_t aPeriodMs )
+{
+    std::unique_lock<std::mutex> lLock( mMutex );
+    sEntry *lEntry = FindLocked( aSensor );
+
+    if( lEntry == nullptr )
+    {
+        throw std::invalid_argument( "Sensor not found." );
+    }
+
+    lEntry->mPeriod = std::chrono::milliseconds( aPeriodMs );
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn std::vector<LeddarDevice::LdSensor *> LeddarDevice::LdSensorManager::GetSensors( void )
+///
+/// \brief  Gets the sensors, in the order they were added.
+///
+/// \author David Levy
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+std::vector<LeddarDevice::LdSensor *>
+LeddarDevice::LdSensorManager::GetSensors( void )
+{
+    std::lock_guard<std::mutex> lLock( mMutex );
+    std::vector<LdSensor *> lSensors;
+
+    for( size_t i = 0; i < mEntries.size(); ++i )
+    {
+        lSensors.push_back( mEntries[i]->mSensor );
+    }
+
+    return lSensors;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn LeddarDevice::LdSensorManager::sSensorStats LeddarDevice::LdSensorManager::GetStats( LdSensor *aSensor )
+///
+/// \brief  Gets a copy of the statistics of a sensor.
+///
+/// \exception  std::invalid_argument   Thrown if the sensor was not added.
+///
+/// \param [in] aSensor The sensor.
+///
+/// \author David Levy
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+LeddarDevice::LdSensorManager::sSensorStats
+LeddarDevice::LdSensorManager::GetStats( LdSensor *aSensor )
+{
+    std::lock_guard<std::mutex> lLock( mMutex );
+    sEntry *lEntry = FindLocked( aSensor );
+
+    if( lEntry == nullptr )
+    {
+        throw std::invalid_argument( "Sensor not found." );
+    }
+
+    return lEntry->mStats;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LeddarDevice::LdSensorManager::ResetStats( void )
+///
+/// \brief  Resets the statistics of all sensors.
+///
+/// \author David Levy
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void
+LeddarDevice::LdSensorManager::ResetStats( void )
+{
+    std::lock_guard<std::mutex> lLock( mMutex );
+    Clock::time_point lNow = Clock::now();
+
+    for( size_t i = 0; i < mEntries.size(); ++i )
+    {
+        ClearStats( mEntries[i]->mStats );
+        mEntries[i]->mFpsStart = lNow;
+        mEntries[i]->mFpsFrames = 0;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LeddarDevice::LdSensorManager::Start( void )
+///
+/// \brief  Starts the workers. Does nothing if they are already running.
+///
+/// \author David Levy
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void
+LeddarDevice::LdSensorManager::Start( void )
+{
+    if( !mWorkers.empty() )
+        return;
+
+    //The workers wait for the lock, the ids are recorded before they poll
+    std::lock_guard<std::mutex> lLock( mMutex );
+    mStop = false;
+
+    for( size_t i = 0; i < mWorkerCount; ++i )
+    {
+        mWorkers.push_back( std::thread( &LdSensorManager::Run, this, i ) );
+        mWorkerIds.push_back( mWorkers.back().get_id() );
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LeddarDevice::LdSensorManager::Stop( void )
+///
+/// \brief  Stops the workers, waiting for the polls in progress. The sensors stay in the manager.
+///
+/// \exception  std::logic_error    Thrown if called from a worker thread (a signal handler of a sensor), it would join itself.
+///
+/// \author David Levy
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void
+LeddarDevice::LdSensorManager::Stop( void )
+{
+    {
+        std::lock_guard<std::mutex> lLock( mMutex );
+
+        if( IsWorkerLocked() )
+        {
+            throw std::logic_error( "Stop cannot be called from a sensor signal handler." );
+        }
+
+        mStop = true;
+    }
+
+    mCondition.notify_all();
+
+    for( size_t i = 0; i < mWorkers.size(); ++i )
+    {
+        mWorkers[i].join();
+    }
+
+    mWorkers.clear();
+
+    std::lock_guard<std::mutex> lLock( mMutex );
+    mWorkerIds.clear();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LeddarDevice::LdSensorManager::Run( size_t aWorker )
+///
+/// \brief  Worker thread: polls the due sensors, or waits for the next one.
+///
+/// \param  aWorker Index of the worker.
+///
+/// \author David Levy
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void
+LeddarDevice::LdSensorManager::Run( size_t aWorker )
+{
+    std::unique_lock<std::mutex> lLock( mMutex );
+
+    while( !mStop )
+    {
+        Clock::time_point lNext = Clock::time_point::max();
+        sEntry *lEntry = PickLocked( aWorker, Clock::now(), lNext );
+
+        if( lEntry != nullptr )
+        {
+            Poll( aWorker, lEntry, lLock );
+        }
+        else if( lNext == Clock::time_point::max() )
+        {
+            mCondition.wait( lLock );
+        }
+        else
+        {
+            mCondition.wait_until( lLock, lNext );
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn LeddarDevice::LdSensorManager::sEntry *LeddarDevice::LdSensorManager::PickLocked( size_t aWorker, Clock::time_point aNow, Clock::time_point &aNext )
+///
+/// \brief  Selects the sensor to poll: the most late of the worker's own due sensors, else the most late due sensor
+///         whose home worker is busy. A sensor whose transport is in use by another poll is skipped. mMutex must be held.
+///
+/// \param          aWorker Index of the worker.
+/// \param          aNow    Current time.
+/// \param [in,out] aNext   Due time of the next sensor this worker could poll, if none is due.
+///
+/// \return Null if no sensor is due.
+///
+/// \author David Levy
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+LeddarDevice::LdSensorManager::sEntry *
+LeddarDevice::LdSensorManager::PickLocked( size_t aWorker, Clock::time_point aNow, Clock::time_point &aNext )
+{
+    sEntry *lBest = nullptr;
+    bool lBestOwn = false;
+
+    for( size_t i = 0; i < mEntries.size(); ++i )
+    {
+        sEntry *lEntry = mEntries[i];
+
+        if( lEntry->mBusy || lEntry->mRemoved )
+            continue;
+
+        bool lOwn = lEntry->mHome == aWorker;
+
+        if( !lOwn && !mWorkerBusy[lEntry->mHome] )
+            continue; //The home worker will take it
+
+        if( IsTransportBusyLocked( lEntry->mTransport ) )
+            continue; //Polled when the other sensor on this transport is done, its end of poll wakes up the workers
+
+        if( lEntry->mDue > aNow )
+        {
+            if( lEntry->mDue < aNext )
+                aNext = lEntry->mDue;
+        }
+        else if( lBest == nullptr || ( lOwn && !lBestOwn ) || ( lOwn == lBestOwn && lEntry->mDue < lBest->mDue ) )
+        {
+            lBest = lEntry;
+            lBestOwn = lOwn;
+        }
+    }
+
+    return lBest;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn LeddarDevice::LdSensorManager::sEntry *LeddarDevice::LdSensorManager::FindLocked( LdSensor *aSensor )
+///
+/// \brief  Finds the entry of a sensor. mMutex must be held.
+///
+/// \param [in] aSensor The sensor.
+///
+/// \return Null if not found (or being removed).
+///
+/// \author David Levy
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+LeddarDevice::LdSensorManager::sEntry *
+LeddarDevice::LdSensorManager::FindLocked( LdSensor *aSensor )
+{
+    for( size_t i = 0; i < mEntries.size(); ++i )
+    {
+        if( mEntries[i]->mSensor == aSensor && !mEntries[i]->mRemoved )
+            return mEntries[i];
+    }
+
+    return nullptr;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn bool LeddarDevice::LdSensorManager::IsTransportBusyLocked( const void *aTransport ) const
+///
+/// \brief  Checks if a sensor on this transport is being polled. mMutex must be held.
+///
+/// \param  aTransport  Transport key (LdConnection::GetTransportKey).
+///
+/// \author David Levy
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool
+LeddarDevice::LdSensorManager::IsTransportBusyLocked( const void *aTransport ) const
+{
+    for( size_t i = 0; i < mEntries.size(); ++i )
+    {
+        if( mEntries[i]->mBusy && mEntries[i]->mTransport == aTransport )
+            return true;
+    }
+
+    return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn bool LeddarDevice::LdSensorManager::IsWorkerLocked( void ) const
+///
+/// \brief  Checks if the calling thread is one of the workers, i.e. a signal handler of a sensor. mMutex must be held.
+///
+/// \author David Levy
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool
+LeddarDevice::LdSensorManager::IsWorkerLocked( void ) const
+{
+    std::thread::id lId = std::this_thread::get_id();
+
+    for( size_t i = 0; i < mWorkerIds.size(); ++i )
+    {
+        if( mWorkerIds[i] == lId )
+            return true;
+    }
+
+    return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LeddarDevice::LdSensorManager::Poll( size_t aWorker, sEntry *aEntry, std::unique_lock<std::mutex> &aLock )
+///
+/// \brief  Calls GetData without holding the lock, then updates the statistics and schedules the next poll.
+///
+/// \param          aWorker Index of the worker.
+/// \param [in,out] aEntry  The sensor to poll.
+/// \param [in,out] aLock   Lock on mMutex, released during GetData.
+///
+/// \author David Levy
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void
+LeddarDevice::LdSensorManager::Poll( size_t aWorker, sEntry *aEntry, std::unique_lock<std::mutex> &aLock )
+{
+    aEntry->mBusy = true;
+    mWorkerBusy[aWorker] = true;
+
+    //The other sensors of this worker can now be stolen
+    mCondition.notify_all();
+    aLock.unlock();
+
+    bool lNewData = false;
+    bool lFailed = false;
+    std::string lError;
+    Clock::time_point lStart = Clock::now();
+
+    try
+    {
+        lNewData = aEntry->mSensor->GetData();
+    }
+    catch( std::exception &e )
+    {
+        lFailed = true;
+        lError = e.what();
+    }
+
+    Clock::time_point lEnd = Clock::now();
+
+    aLock.lock();
+    aEntry->mBusy = false;
+    mWorkerBusy[aWorker] = false;
+
+    sSensorStats &lStats = aEntry->mStats;
+    uint32_t lDurationUs = static_cast<uint32_t>( std::chrono::duration_cast<std::chrono::microseconds>( lEnd - lStart ).count() );
+    ++lStats.mPollCount;
+    lStats.mLastDurationUs = lDurationUs;
+
+    if( lDurationUs > lStats.mMaxDurationUs )
+        lStats.mMaxDurationUs = lDurationUs;
+
+    if( aEntry->mHome != aWorker )
+        ++lStats.mStealCount;
+
+    if( lFailed )
+    {
+        ++lStats.mErrorCount;
+        lStats.mLastError = lError;
+    }
+    else if( lNewData )
+    {
+        ++lStats.mFrameCount;
+        ++aEntry->mFpsFrames;
+    }
+
+    double lElapsed = std::chrono::duration<double>( lEnd - aEntry->mFpsStart ).count();
+
+    if( lElapsed >= 1.0 )
+    {
+        lStats.mFps = static_cast<float>( aEntry->mFpsFrames / lElapsed );
+        aEntry->mFpsStart = lEnd;
+        aEntry->mFpsFrames = 0;
+    }
+
+    // Next poll, skipping the periods that were missed
+    aEntry->mDue += aEntry->mPeriod;
+
+    if( aEntry->mDue < lEnd )
+    {
+        if( aEntry->mPeriod.count() != 0 )
+            ++lStats.mOverrunCount;
+
+        aEntry->mDue = lEnd;
+    }
+
+    //Wakes up RemoveSensor and the workers waiting for this sensor
+    mCondition.notify_all();
+}
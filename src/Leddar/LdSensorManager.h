@@ -0,0 +1,111 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \file   Leddar/LdSensorManager.h
+///
+/// \brief  Declares the LdSensorManager class
+///
+/// Copyright (c) 2018 LeddarTech. All rights reserved.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "LdSensor.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace LeddarDevice
+{
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \class  LdSensorManager
+    ///
+    /// \brief  Calls GetData on a set of sensors from a fixed pool of worker threads.
+    ///
+    ///         Each sensor is polled at its own period and never from two threads at the same time.
+    ///         A sensor has a home worker. When a sensor is due and its home worker is busy (for example in a
+    ///         Modbus timeout), an idle worker steals it, so one stalled sensor does not delay the others.
+    ///         A poll that ends after the next due time counts as an overrun. The missed periods are skipped.
+    ///
+    ///         Sensors that share a transport that is not thread safe (several Modbus unit ids on one serial port,
+    ///         several CAN slaves on one interface, see LdConnection::GetTransportKey) have the same home worker and are
+    ///         never polled at the same time, by any worker.
+    ///
+    ///         The sensors must be connected before they are added. The signals of the sensors (NEW_DATA...)
+    ///         are emitted from the worker threads, where Stop and RemoveSensor cannot be called.
+    ///
+    /// \author David Levy
+    /// \date   October 2026
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    class LdSensorManager
+    {
+    public:
+        struct sSensorStats
+        {
+            uint64_t    mPollCount;         ///< Number of GetData calls
+            uint64_t    mFrameCount;        ///< Number of GetData calls that returned new data
+            uint64_t    mErrorCount;        ///< Number of GetData calls that threw
+            uint64_t    mOverrunCount;      ///< Number of polls that ended after the next due time
+            uint64_t    mStealCount;        ///< Number of polls done by another worker than the home worker
+            float       mFps;               ///< New frames per second, updated every second
+            uint32_t    mLastDurationUs;    ///< Duration of the last GetData call
+            uint32_t    mMaxDurationUs;     ///< Longest GetData call
+            std::string mLastError;         ///< Message of the last exception thrown by GetData
+        };
+
+        explicit LdSensorManager( size_t aWorkerCount = 2 );
+        ~LdSensorManager();
+
+        void                    AddSensor( LdSensor *aSensor, uint32_t aPeriodMs, bool aOwned = true );
+        void                    RemoveSensor( LdSensor *aSensor );
+        void                    SetPeriod( LdSensor *aSensor, uint32_t aPeriodMs );
+        std::vector<LdSensor *> GetSensors( void );
+        sSensorStats            GetStats( LdSensor *aSensor );
+        void                    ResetStats( void );
+
+        void                    Start( void );
+        void                    Stop( void );
+        bool                    IsRunning( void ) const { return !mWorkers.empty(); }
+        size_t                  GetWorkerCount( void ) const { return mWorkerCount; }
+
+    private:
+        typedef std::chrono::steady_clock Clock;
+
+        struct sEntry
+        {
+            LdSensor                   *mSensor;
+            const void                 *mTransport;     ///< Transport key of the sensor connection
+            bool                        mOwned;
+            std::chrono::microseconds   mPeriod;
+            Clock::time_point           mDue;
+            size_t                      mHome;          ///< Index of the home worker
+            bool                        mBusy;          ///< GetData in progress
+            bool                        mRemoved;       ///< RemoveSensor is waiting for the poll to end
+            sSensorStats                mStats;
+            Clock::time_point           mFpsStart;
+            uint64_t                    mFpsFrames;
+        };
+
+        void    Run( size_t aWorker );
+        sEntry *PickLocked( size_t aWorker, Clock::time_point aNow, Clock::time_point &aNext );
+        sEntry *FindLocked( LdSensor *aSensor );
+        bool    IsTransportBusyLocked( const void *aTransport ) const;
+        bool    IsWorkerLocked( void ) const;
+        void    Poll( size_t aWorker, sEntry *aEntry, std::unique_lock<std::mutex> &aLock );
+
+        size_t                      mWorkerCount;
+        size_t                      mNextHome;
+        std::vector<sEntry *>       mEntries;
+        std::vector<bool>           mWorkerBusy;
+        std::vector<std::thread>    mWorkers;
+        std::vector<std::thread::id> mWorkerIds;    ///< Protected by mMutex, to detect the calls from a signal handler
+        std::mutex                  mMutex;
+        std::condition_variable     mCondition;
+        bool                        mStop;
+
+        LdSensorManager( const LdSensorManager & ); //Disable copy constructor
+        LdSensorManager &operator=( const LdSensorManager & ); //Disable equal constructor
+    };
+}
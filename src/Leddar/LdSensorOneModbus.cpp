@@ -43,7 +43,7 @@ LdSensorOneModbus::LdSensorOneModbus( LeddarConnection::LdConnection *aConnectio
 
     mConnectionInfoModbus =  aConnection == nullptr ? nullptr : dynamic_cast< const LeddarConnection::LdConnectionInfoModbus * >( aConnection->GetConnectionInfo() );
 
-    mInterface = dynamic_cast< LeddarConnection::LdLibModbusSerial * >( aConnection );
+    mInterface = dynamic_cast< LeddarConnection::LdInterfaceModbus * >( aConnection );
 
     InitProperties();
 }
@@ -155,7 +155,6 @@ LdSensorOneModbus::GetEchoes( void )
                               MODBUS_CRC_SIZE +
                               sizeof( LtComLeddarOneModbus::sLeddarOneDetections ) );
     size_t lReceivedSize = mInterface->ReceiveRawConfirmation( lResponse, lSizeToReceive );
-    LeddarUtils::LtTimeUtils::WaitBlockingMicro( ONE_WAIT_AFTER_REQUEST );
 
     if( lReceivedSize <= MODBUS_DATA_OFFSET )
     {
@@ -214,7 +213,6 @@ LdSensorOneModbus::GetConfig( void )
     //All other registers are either used or not readable
     uint16_t lResponse[LTMODBUS_RTU_MAX_ADU_LENGTH / 2] = { 0 };
     mInterface->ReadRegisters( 0, 5, lResponse );
-    LeddarUtils::LtTimeUtils::WaitBlockingMicro( ONE_WAIT_AFTER_REQUEST );
 
     GetProperties()->GetIntegerProperty( LeddarCore::LdPropertyIds::ID_ACCUMULATION_EXP )->SetValue( 0, lResponse[0] );
     GetProperties()->GetIntegerProperty( LeddarCore::LdPropertyIds::ID_ACCUMULATION_EXP )->SetClean();
@@ -227,7 +225,6 @@ LdSensorOneModbus::GetConfig( void )
 
     memset( lResponse, 0, LTMODBUS_RTU_MAX_ADU_LENGTH );
     mInterface->ReadRegisters( 29, 2, lResponse );
-    LeddarUtils::LtTimeUtils::WaitBlockingMicro( ONE_WAIT_AFTER_REQUEST );
     GetProperties()->GetEnumProperty( LeddarCore::LdPropertyIds::ID_COM_SERIAL_PORT_BAUDRATE )->SetValueIndex( 0, lResponse[0] );
     GetProperties()->GetEnumProperty( LeddarCore::LdPropertyIds::ID_COM_SERIAL_PORT_BAUDRATE )->SetClean();
     GetProperties()->GetIntegerProperty( LeddarCore::LdPropertyIds::ID_COM_SERIAL_PORT_ADDRESS )->SetValue( 0, lResponse[1] );
@@ -237,7 +234,6 @@ LdSensorOneModbus::GetConfig( void )
     {
         memset( lResponse, 0, LTMODBUS_RTU_MAX_ADU_LENGTH );
         mInterface->ReadRegisters( 6, 2, lResponse );
-        LeddarUtils::LtTimeUtils::WaitBlockingMicro( ONE_WAIT_AFTER_REQUEST );
         GetProperties()->GetBoolProperty( LeddarCore::LdPropertyIds::ID_LED_AUTO_PWR_ENABLE )->SetValue( 0, lResponse[0] != 0 );
         GetProperties()->GetBoolProperty( LeddarCore::LdPropertyIds::ID_LED_AUTO_PWR_ENABLE )->SetClean();
         GetProperties()->GetIntegerProperty( LeddarCore::LdPropertyIds::ID_CHANGE_DELAY )->SetValue( 0, lResponse[1] );
@@ -245,7 +241,6 @@ LdSensorOneModbus::GetConfig( void )
 
         memset( lResponse, 0, LTMODBUS_RTU_MAX_ADU_LENGTH );
         mInterface->ReadRegisters( 11, 1, lResponse );
-        LeddarUtils::LtTimeUtils::WaitBlockingMicro( ONE_WAIT_AFTER_REQUEST );
         GetProperties()->GetIntegerProperty( LeddarCore::LdPropertyIds::ID_PRECISION )->SetValue( 0, static_cast<int16_t>( lResponse[0] ) );
         GetProperties()->GetIntegerProperty( LeddarCore::LdPropertyIds::ID_PRECISION )->SetClean();
     }
@@ -254,7 +249,6 @@ LdSensorOneModbus::GetConfig( void )
     {
         memset( lResponse, 0, LTMODBUS_RTU_MAX_ADU_LENGTH );
         mInterface->ReadRegisters( 9, 5, lResponse );
-        LeddarUtils::LtTimeUtils::WaitBlockingMicro( ONE_WAIT_AFTER_REQUEST );
         GetProperties()->GetBoolProperty( LeddarCore::LdPropertyIds::ID_STATIC_NOISE_REMOVAL_ENABLE )->SetValue( 0, lResponse[0] != 0 );
         GetProperties()->GetBoolProperty( LeddarCore::LdPropertyIds::ID_STATIC_NOISE_REMOVAL_ENABLE )->SetClean();
         GetProperties()->GetBoolProperty( LeddarCore::LdPropertyIds::ID_STATIC_NOISE_UPDATE_ENABLE )->SetValue( 0, lResponse[1] != 0 );
@@ -327,7 +321,6 @@ LdSensorOneModbus::SetConfig( void )
 
             mInterface->WriteRegister( ( *lPropertyIter )->GetDeviceId(), lValue );
             ( *lPropertyIter )->SetClean();
-            LeddarUtils::LtTimeUtils::WaitBlockingMicro( ONE_WAIT_AFTER_REQUEST );
         }
     }
 }
@@ -372,7 +365,6 @@ LdSensorOneModbus::GetConstants( void )
 
     mInterface->SendRawRequest( lRawRequest, 2 );
     size_t lReceivedSize = mInterface->ReceiveRawConfirmation( lResponse, 0 );
-    LeddarUtils::LtTimeUtils::WaitBlockingMicro( ONE_WAIT_AFTER_REQUEST );
 
     if( lReceivedSize <= MODBUS_DATA_OFFSET )
     {
@@ -20,7 +20,7 @@
 #include "LdSensor.h"
 #include "LdConnectionInfoModbus.h"
 
-#include "LdLibModbusSerial.h"
+#include "LdInterfaceModbus.h"
 
 namespace LeddarDevice
 {
@@ -45,7 +45,7 @@ namespace LeddarDevice
         virtual bool    RequestData( uint32_t &aDataMask );
 
         const LeddarConnection::LdConnectionInfoModbus  *mConnectionInfoModbus;
-        LeddarConnection::LdLibModbusSerial *mInterface;
+        LeddarConnection::LdInterfaceModbus *mInterface;
 
     private:
         void            InitProperties( void );
@@ -39,6 +39,7 @@
 #include "LtSystemUtils.h"
 #include "LtTimeUtils.h"
 
+#include <algorithm>
 #include <cstddef>
 #include <cstring>
 #include <iomanip>
@@ -47,6 +48,114 @@
 using namespace LeddarCore;
 using namespace LeddarConnection;
 
+namespace
+{
+    const uint16_t MAX_ECHO_READ_SIZE = 512;        ///< Size of the echo reads that all firmwares accept
+    const uint8_t  MAX_COMBINED_READ_FAILURES = 3;
+
+    void DecodeEchoes( const uint8_t *aSource, std::vector<LdEcho> &aEchoes, uint16_t aFirst, uint16_t aCount )
+    {
+        const sEchoLigth *lDetections = reinterpret_cast<const sEchoLigth *>( aSource );
+
+        for( uint16_t i = 0; i < aCount; ++i )
+        {
+            LdEcho &lEcho = aEchoes[ aFirst + i ];
+            lEcho.mChannelIndex = lDetections[ i ].mSegment;
+            lEcho.mDistance = lDetections[ i ].mDistance;
+            lEcho.mAmplitude = lDetections[ i ].mAmplitude;
+            lEcho.mFlag = lDetections[ i ].mFlag;
+        }
+    }
+
+    const uint32_t MAX_BURST_GAP = 128;     ///< Bytes read or written through rather than splitting a register transaction
+
+    struct sRegisterRange
+    {
+        uint32_t mOffset;
+        uint32_t mSize;
+    };
+
+    bool RangeBefore( const sRegisterRange &aLeft, const sRegisterRange &aRight )
+    {
+        return aLeft.mOffset < aRight.mOffset;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn void ReadRanges( LdConnectionUniversal *aConnection, uint32_t aBankAddress, uint8_t *aImage, std::vector<sRegisterRange> aRanges )
+    ///
+    /// \brief  Read some fields of a register bank, merging the fields closer than MAX_BURST_GAP in one burst.
+    ///         Each field lands at its offset in aImage, the bytes of the gaps too.
+    ///
+    /// \author David Levy
+    /// \date   October 2026
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    void ReadRanges( LdConnectionUniversal *aConnection, uint32_t aBankAddress, uint8_t *aImage, std::vector<sRegisterRange> aRanges )
+    {
+        std::sort( aRanges.begin(), aRanges.end(), RangeBefore );
+
+        for( size_t i = 0; i < aRanges.size(); )
+        {
+            uint32_t lBegin = aRanges[ i ].mOffset;
+            uint32_t lEnd = lBegin + aRanges[ i ].mSize;
+
+            for( ++i; i < aRanges.size() && aRanges[ i ].mOffset <= lEnd + MAX_BURST_GAP; ++i )
+            {
+                lEnd = std::max( lEnd, aRanges[ i ].mOffset + aRanges[ i ].mSize );
+            }
+
+            aConnection->ReadBlock( aBankAddress + lBegin, aImage + lBegin, lEnd - lBegin, 5 );
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn void WriteChangedRanges( LdConnectionUniversal *aConnection, uint32_t aBankAddress, const uint8_t *aImage, const uint8_t *aLastImage, uint32_t aSize )
+    ///
+    /// \brief  Write the bytes of aImage that differ from aLastImage, one write per group of changes closer than MAX_BURST_GAP.
+    ///
+    /// \param  aConnection     The connection.
+    /// \param  aBankAddress    Address of the first byte of the images.
+    /// \param  aImage          Bytes to write.
+    /// \param  aLastImage      What the device holds, nullptr if unknown to write all of aImage.
+    /// \param  aSize           Size of the images.
+    ///
+    /// \author David Levy
+    /// \date   October 2026
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    void WriteChangedRanges( LdConnectionUniversal *aConnection, uint32_t aBankAddress, const uint8_t *aImage, const uint8_t *aLastImage, uint32_t aSize )
+    {
+        if( aLastImage == nullptr )
+        {
+            aConnection->Write( 0x2, aBankAddress, const_cast<uint8_t *>( aImage ), aSize, 5 );
+            return;
+        }
+
+        uint32_t lOffset = 0;
+
+        while( lOffset < aSize )
+        {
+            if( aImage[ lOffset ] == aLastImage[ lOffset ] )
+            {
+                ++lOffset;
+                continue;
+            }
+
+            uint32_t lBegin = lOffset;
+            uint32_t lEnd = lOffset + 1;
+
+            for( lOffset = lEnd; lOffset < aSize && lOffset <= lEnd + MAX_BURST_GAP; ++lOffset )
+            {
+                if( aImage[ lOffset ] != aLastImage[ lOffset ] )
+                {
+                    lEnd = lOffset + 1;
+                }
+            }
+
+            aConnection->Write( 0x2, aBankAddress + lBegin, const_cast<uint8_t *>( aImage + lBegin ), lEnd - lBegin, 5 );
+            lOffset = lEnd;
+        }
+    }
+}
+
 #define LICENSE_USER_SIZE 32
 #define LICENSE_NUMBER 3
 
@@ -73,7 +182,10 @@ LdSensorVu::LdSensorVu( LeddarConnection::LdConnection *aConnection ) :
     mCarrier( nullptr ),
 #endif
     mErrorFlag( false ),
-    mBackupFlagAvailable( true )
+    mBackupFlagAvailable( true ),
+    mCombinedEchoRead( true ),
+    mCombinedReadFailures( 0 ),
+    mLastEchoCount( 0 )
 {
     InitProperties();
     mConnectionUniversal = dynamic_cast<LdConnectionUniversal *>( aConnection );
@@ -240,14 +352,45 @@ LdSensorVu::GetConfig()
         }
 
         // ------------- Read configuration data from sensor -------------
-        uint8_t *lInputBuffer, *lOutputBuffer;
-        mConnectionUniversal->InternalBuffers( lInputBuffer, lOutputBuffer );
-        mConnectionUniversal->Read( 0xb, GetBankAddress( REGMAP_CFG_DATA ), sizeof( sCfgData ), 5 );
-        sCfgData *lCfgData = reinterpret_cast<sCfgData * >( lOutputBuffer );
+        mCfgImage.clear();
+        mTempCompImage.clear();
+        std::vector<uint8_t> lCfgImage( sizeof( sCfgData ) );
+        mConnectionUniversal->ReadBlock( GetBankAddress( REGMAP_CFG_DATA ), &lCfgImage[ 0 ], sizeof( sCfgData ), 5 );
+        mCfgImage.swap( lCfgImage );
+        const sCfgData *lCfgData = reinterpret_cast<const sCfgData *>( &mCfgImage[ 0 ] );
+
+        // ------------- Read advanced config data from sensor -------------
+        // The fields are scattered in a large bank, read them in a few bursts and decode them from a local image
+        std::vector<sRegisterRange> lAdvRanges;
+        sRegisterRange lRange;
+        lRange.mOffset = offsetof( sAdvCfgData, mTraceBufferType );
+        lRange.mSize = sizeof( uint8_t ) + sizeof( uint32_t );
+        lAdvRanges.push_back( lRange );
+        lRange.mOffset = offsetof( sAdvCfgData, mPeakFilterSumBits );
+        lRange.mSize = sizeof( uint8_t );
+        lAdvRanges.push_back( lRange );
+        lRange.mOffset = offsetof( sAdvCfgData, mLedUserPowerEnable );
+        lRange.mSize = offsetof( sAdvCfgData, mLedUserPowerLut ) - offsetof( sAdvCfgData, mLedUserPowerEnable );
+        lAdvRanges.push_back( lRange );
+        lRange.mOffset = offsetof( sAdvCfgData, mLedUserPercentLut );
+        lRange.mSize = offsetof( sAdvCfgData, mDemAmpThrMin ) - offsetof( sAdvCfgData, mLedUserPercentLut );
+        lAdvRanges.push_back( lRange );
+        lRange.mOffset = offsetof( sAdvCfgData, mPeakRealDistanceOffset );
+        lRange.mSize = offsetof( sAdvCfgData, mPeakNbSampleForBaseLevEst ) - offsetof( sAdvCfgData, mPeakRealDistanceOffset );
+        lAdvRanges.push_back( lRange );
+        lRange.mOffset = offsetof( sAdvCfgData, mPeakRefDistEnable );
+        lRange.mSize = sizeof( uint8_t );
+        lAdvRanges.push_back( lRange );
+        lRange.mOffset = offsetof( sAdvCfgData, mPeakTempEnable );
+        lRange.mSize = sizeof( uint8_t );
+        lAdvRanges.push_back( lRange );
+
+        std::vector<uint8_t> lAdvImage( offsetof( sAdvCfgData, mDemAmpThrMin ) );
+        ReadRanges( mConnectionUniversal, GetBankAddress( REGMAP_ADV_CFG_DATA ), &lAdvImage[ 0 ], lAdvRanges );
 
         // Device name
         LeddarCore::LdTextProperty *lTextProp = GetProperties()->GetTextProperty( LeddarCore::LdPropertyIds::ID_DEVICE_NAME );
-        lTextProp->SetValue( 0, std::string( reinterpret_cast<char *>( lCfgData->mDeviceName ), REGMAP_PRODUCT_NAME_LENGTH ) );
+        lTextProp->SetValue( 0, std::string( reinterpret_cast<const char *>( lCfgData->mDeviceName ), REGMAP_PRODUCT_NAME_LENGTH ) );
         lTextProp->SetClean();
 
         // Accumulation exponent
@@ -354,23 +497,17 @@ LdSensorVu::GetConfig()
         lBoolProp->SetValue( 0, lCfgData->mStNoiseRmvEnable == 1 );
         lBoolProp->SetClean();
 
-        // ------------- Read advanced config data from sensor (part 1) -------------
-        mConnectionUniversal->Read( 0xb, GetBankAddress( REGMAP_ADV_CFG_DATA ) + offsetof( sAdvCfgData, mTraceBufferType ),
-                                    sizeof( uint8_t ) + sizeof( uint32_t ), 0 );
-
         // Field of view
+        uint32_t lFieldOfView;
+        memcpy( &lFieldOfView, &lAdvImage[ offsetof( sAdvCfgData, mFieldOfView ) ], sizeof( lFieldOfView ) );
         lFloatProp = GetProperties()->GetFloatProperty( LeddarCore::LdPropertyIds::ID_HFOV );
         lFloatProp->SetScale( lDistanceScale );
-        lFloatProp->ForceRawValue( 0, *( ( uint32_t * )( &lOutputBuffer[ 1 ] ) ) );
+        lFloatProp->ForceRawValue( 0, lFieldOfView );
         lFloatProp->SetClean();
 
-        // -------------  Read advanced config data from sensor (part 2) -------------
-        mConnectionUniversal->Read( 0xb, GetBankAddress( REGMAP_ADV_CFG_DATA ) + offsetof( sAdvCfgData, mPeakFilterSumBits ),
-                                    sizeof( uint8_t ), 5 );
-
         // Amplitude scales
         lIntProp = GetProperties()->GetIntegerProperty( LeddarCore::LdPropertyIds::ID_FILTERED_AMP_SCALE_BITS );
-        lIntProp->ForceValue( 0, *( lOutputBuffer ) );
+        lIntProp->ForceValue( 0, lAdvImage[ offsetof( sAdvCfgData, mPeakFilterSumBits ) ] );
         lIntProp->SetClean();
         uint8_t lFilteredAmpScaleBits = lIntProp->ValueT<uint8_t>();
 
@@ -379,22 +516,14 @@ LdSensorVu::GetConfig()
         lIntProp->ForceValue( 0, 1 << ( lRawAmplBit + lFilteredAmpScaleBits ) );
         lIntProp->SetClean();
 
-        // -------------  Read advanced config data from sensor (part 3) -------------
-        mConnectionUniversal->Read( 0xb, GetBankAddress( REGMAP_ADV_CFG_DATA ) + offsetof( sAdvCfgData, mLedUserPowerEnable ),
-                                    offsetof( sAdvCfgData, mLedUserPowerLut ) - offsetof( sAdvCfgData, mLedUserPowerEnable ), 5 );
-
         // User led power count
-        uint8_t lLedPwrCount = *( lOutputBuffer + offsetof( sAdvCfgData, mLedUsrPowerCount ) - offsetof( sAdvCfgData, mLedUserPowerEnable ) );
+        uint8_t lLedPwrCount = lAdvImage[ offsetof( sAdvCfgData, mLedUsrPowerCount ) ];
         lIntProp = GetProperties()->GetIntegerProperty( LeddarCore::LdPropertyIds::ID_LED_USR_PWR_COUNT );
         lIntProp->ForceValue( 0, lLedPwrCount );
         lBoolProp->SetClean();
 
-        // -------------  Read advanced config data from sensor (part 4) -------------
-        mConnectionUniversal->Read( 0xb, GetBankAddress( REGMAP_ADV_CFG_DATA ) + offsetof( sAdvCfgData, mLedUserPercentLut ),
-                                    offsetof( sAdvCfgData, mDemAmpThrMin ) - offsetof( sAdvCfgData, mLedUserPercentLut ), 5 );
-
         // User led power lookup table
-        uint8_t *lLedPwrLUT = lOutputBuffer;
+        const uint8_t *lLedPwrLUT = &lAdvImage[ offsetof( sAdvCfgData, mLedUserPercentLut ) ];
         LeddarCore::LdEnumProperty *lLedIntensityProp = GetProperties()->GetEnumProperty( LeddarCore::LdPropertyIds::ID_LED_INTENSITY );
         lLedIntensityProp->SetEnumSize( lLedPwrCount );
 
@@ -434,34 +563,31 @@ LdSensorVu::GetConfig()
 
         lLedIntensityProp->SetClean();
 
-        // -------------  Read advanced config data from sensor (part 5) -------------
-        mConnectionUniversal->Read( 0xb, GetBankAddress( REGMAP_ADV_CFG_DATA ) + offsetof( sAdvCfgData, mPeakRealDistanceOffset ),
-                                    offsetof( sAdvCfgData, mPeakNbSampleForBaseLevEst ) - offsetof( sAdvCfgData, mPeakRealDistanceOffset ), 5 );
-
         // Real distance offset
-        uint32_t *lPeakRealDistanceOffset = ( uint32_t * )( lOutputBuffer );
+        uint32_t lPeakRealDistanceOffset;
+        memcpy( &lPeakRealDistanceOffset, &lAdvImage[ offsetof( sAdvCfgData, mPeakRealDistanceOffset ) ], sizeof( lPeakRealDistanceOffset ) );
         lFloatProp = GetProperties()->GetFloatProperty( LeddarCore::LdPropertyIds::ID_REAL_DISTANCE_OFFSET );
         lFloatProp->SetScale( lDistanceScale );
         lFloatProp->SetCount( 1 );
-        lFloatProp->ForceRawValue( 0, *lPeakRealDistanceOffset );
+        lFloatProp->ForceRawValue( 0, lPeakRealDistanceOffset );
 
-        // -------------  Read advanced config data from sensor (part 6) -------------
+        // Temperature compensation
         LeddarCore::LdBitFieldProperty *lBitFieldProp = GetProperties()->GetBitProperty( LeddarCore::LdPropertyIds::ID_TEMP_COMP );
         lBitFieldProp->SetValue( 0, 0 );
-        mConnectionUniversal->Read( 0xb, GetBankAddress( REGMAP_ADV_CFG_DATA ) + offsetof( sAdvCfgData, mPeakRefDistEnable ), sizeof( uint8_t ), 5 );
 
-        if( *lOutputBuffer != 0 )
+        if( lAdvImage[ offsetof( sAdvCfgData, mPeakRefDistEnable ) ] != 0 )
         {
             lBitFieldProp->SetBit( 0, 0 );
         }
 
-        mConnectionUniversal->Read( 0xb, GetBankAddress( REGMAP_ADV_CFG_DATA ) + offsetof( sAdvCfgData, mPeakTempEnable ), sizeof( uint8_t ), 5 );
-
-        if( *lOutputBuffer != 0 )
+        if( lAdvImage[ offsetof( sAdvCfgData, mPeakTempEnable ) ] != 0 )
         {
             lBitFieldProp->SetBit( 0, 1 );
         }
 
+        mTempCompImage.push_back( lBitFieldProp->BitState( 0, 0 ) );
+        mTempCompImage.push_back( lBitFieldProp->BitState( 0, 1 ) );
+
         // Initialize results.
         uint32_t lTotalSegments = mProperties->GetIntegerProperty( LdPropertyIds::ID_VSEGMENT )->ValueT<uint16_t>() *
                                   mProperties->GetIntegerProperty( LdPropertyIds::ID_HSEGMENT )->ValueT<uint16_t>();
@@ -493,6 +619,7 @@ LdSensorVu::GetConfig()
 /// \fn void LdSensorVu::SetConfig()
 ///
 /// \brief  Set configuration to the device, store result in the properties.
+///         Only the bytes that differ from the last GetConfig or SetConfig are written, all of them if there was none.
 ///
 /// \author Patrick Boulay
 /// \date   March 2016
@@ -502,10 +629,8 @@ LdSensorVu::SetConfig()
 {
     try
     {
-        uint8_t *lInputBuffer, *lOutputBuffer;
-        mConnectionUniversal->InternalBuffers( lInputBuffer, lOutputBuffer );
-        sCfgData *lCfgData = reinterpret_cast< sCfgData *>( lInputBuffer );
-        memset( lCfgData, 0, sizeof( sCfgData ) );
+        std::vector<uint8_t> lCfgImage( sizeof( sCfgData ), 0 );
+        sCfgData *lCfgData = reinterpret_cast< sCfgData *>( &lCfgImage[ 0 ] );
 
         // ------------- Set configuration data in sensor -------------
         // Device name
@@ -599,23 +724,33 @@ LdSensorVu::SetConfig()
         lBoolProp = GetProperties()->GetBoolProperty( LeddarCore::LdPropertyIds::ID_STATIC_NOISE_REMOVAL_ENABLE );
         lCfgData->mStNoiseRmvEnable = lBoolProp->Value() == true ? 1 : 0;
 
-        // Write config data into the sensor.
-        mConnectionUniversal->Write( 0x2, GetBankAddress( REGMAP_CFG_DATA ), sizeof( sCfgData ), 5 );
+        // Write config data into the sensor, only the bytes that changed since the last read or write.
+        std::vector<uint8_t> lLastCfgImage;
+        lLastCfgImage.swap( mCfgImage );
+        WriteChangedRanges( mConnectionUniversal, GetBankAddress( REGMAP_CFG_DATA ), &lCfgImage[ 0 ],
+                            lLastCfgImage.empty() ? nullptr : &lLastCfgImage[ 0 ], sizeof( sCfgData ) );
+        mCfgImage.swap( lCfgImage );
 
-        // -------------  Write advanced config data from sensor (part 6 of GetConfig) -------------
-        //Need an integrator license to write it
-        std::vector<LeddarDefines::sLicense> lLicenses = GetLicenses();
+        // -------------  Write advanced config data from sensor (temperature compensation of GetConfig) -------------
+        static_assert( offsetof( sAdvCfgData, mPeakTempEnable ) == offsetof( sAdvCfgData, mPeakRefDistEnable ) + 1, "Temperature compensation enables not adjacent" );
+        lBitFieldProp = GetProperties()->GetBitProperty( LeddarCore::LdPropertyIds::ID_TEMP_COMP );
+        uint8_t lTempComp[ 2 ] = { static_cast<uint8_t>( lBitFieldProp->BitState( 0, 0 ) ), static_cast<uint8_t>( lBitFieldProp->BitState( 0, 1 ) ) };
 
-        for( size_t i = 0; i < lLicenses.size(); i++ )
+        if( mTempCompImage.size() != sizeof( lTempComp ) || memcmp( &mTempCompImage[ 0 ], lTempComp, sizeof( lTempComp ) ) != 0 )
         {
-            if( lLicenses[i].mType == LeddarDefines::LT_INTEGRATOR || lLicenses[i].mType == LeddarDefines::LT_ADMIN )
+            //Need an integrator license to write it
+            std::vector<LeddarDefines::sLicense> lLicenses = GetLicenses();
+
+            for( size_t i = 0; i < lLicenses.size(); i++ )
             {
-                lBitFieldProp = GetProperties()->GetBitProperty( LeddarCore::LdPropertyIds::ID_TEMP_COMP );
-                *lInputBuffer = lBitFieldProp->BitState( 0, 0 );
-                mConnectionUniversal->Write( 0x2, GetBankAddress( REGMAP_ADV_CFG_DATA ) + offsetof( sAdvCfgData, mPeakRefDistEnable ), sizeof( uint8_t ), 5 );
-                *lInputBuffer = lBitFieldProp->BitState( 0, 1 );
-                mConnectionUniversal->Write( 0x2, GetBankAddress( REGMAP_ADV_CFG_DATA ) + offsetof( sAdvCfgData, mPeakTempEnable ), sizeof( uint8_t ), 5 );
-                break;
+                if( lLicenses[i].mType == LeddarDefines::LT_INTEGRATOR || lLicenses[i].mType == LeddarDefines::LT_ADMIN )
+                {
+                    mTempCompImage.clear();
+                    mConnectionUniversal->Write( 0x2, GetBankAddress( REGMAP_ADV_CFG_DATA ) + offsetof( sAdvCfgData, mPeakRefDistEnable ), lTempComp,
+                                                 sizeof( lTempComp ), 5 );
+                    mTempCompImage.assign( lTempComp, lTempComp + sizeof( lTempComp ) );
+                    break;
+                }
             }
         }
 
@@ -657,6 +792,10 @@ LdSensorVu::GetConstants()
         uint8_t *lInputBuffer, *lOutputBuffer;
         mConnectionUniversal->InternalBuffers( lInputBuffer, lOutputBuffer );
 
+        // A new device or a new session, the config images are of no use
+        mCfgImage.clear();
+        mTempCompImage.clear();
+
         // ---- DEVICE INFO ----
         mConnectionUniversal->Read( 0xb, GetBankAddress( REGMAP_DEV_INFO ), sizeof( sDevInfo ), 5 );
         sDevInfo *lDevInfo = reinterpret_cast< sDevInfo * >( lOutputBuffer );
@@ -854,20 +993,24 @@ LdSensorVu::GetCalib()
 {
     uint32_t lDistanceScale = GetProperties()->GetIntegerProperty( LeddarCore::LdPropertyIds::ID_DISTANCE_SCALE )->ValueT<uint32_t>();
 
-    // Get comm internal buffer
-    uint8_t *lInputBuffer, *lOutputBuffer;
-    /*const uint16_t lBufferSize = */mConnectionUniversal->InternalBuffers( lInputBuffer, lOutputBuffer );
+    uint8_t lLedPwrCount = GetProperties()->GetIntegerProperty( LeddarCore::LdPropertyIds::ID_LED_USR_PWR_COUNT )->ValueT<uint8_t>();
 
-    // Timebase delay
-    mConnectionUniversal->Read( 0xb, GetBankAddress( REGMAP_ADV_CFG_DATA ) + offsetof( sAdvCfgData, mPeakCalibrationOffset ),
-                                sizeof( int32_t )* mChannelCount, 5 );
+    // The timebase delays and the compensations are in the same area of the bank, read them in one burst
+    std::vector<sRegisterRange> lRanges( 2 );
+    lRanges[ 0 ].mOffset = offsetof( sAdvCfgData, mPeakCalibrationOffset );
+    lRanges[ 0 ].mSize = sizeof( int32_t ) * mChannelCount;
+    lRanges[ 1 ].mOffset = offsetof( sAdvCfgData, mPeakCalibrationLed );
+    lRanges[ 1 ].mSize = sizeof( int32_t ) * lLedPwrCount;
+    std::vector<uint8_t> lAdvImage( lRanges[ 1 ].mOffset + lRanges[ 1 ].mSize );
+    ReadRanges( mConnectionUniversal, GetBankAddress( REGMAP_ADV_CFG_DATA ), &lAdvImage[ 0 ], lRanges );
 
+    // Timebase delay
     if( mCalibrationOffsetBackup == nullptr )
     {
         mCalibrationOffsetBackup = new int32_t[ mChannelCount ];
     }
 
-    memcpy( mCalibrationOffsetBackup, lOutputBuffer, mChannelCount * sizeof( int32_t ) );
+    memcpy( mCalibrationOffsetBackup, &lAdvImage[ lRanges[ 0 ].mOffset ], mChannelCount * sizeof( int32_t ) );
     LeddarCore::LdFloatProperty *lTimebaseDelayProp = GetProperties()->GetFloatProperty( LeddarCore::LdPropertyIds::ID_TIMEBASE_DELAY );
     lTimebaseDelayProp->SetScale( lDistanceScale );
     lTimebaseDelayProp->SetCount( mChannelCount );
@@ -880,16 +1023,9 @@ LdSensorVu::GetCalib()
     lTimebaseDelayProp->SetClean();
 
     // Compensations
-    uint8_t lLedPwrCount = GetProperties()->GetIntegerProperty( LeddarCore::LdPropertyIds::ID_LED_USR_PWR_COUNT )->ValueT<uint8_t>();
-    mConnectionUniversal->Read( 0xb, GetBankAddress( REGMAP_ADV_CFG_DATA ) + offsetof( sAdvCfgData, mPeakCalibrationLed ), sizeof( int32_t )* lLedPwrCount, 5 );
-
-    if( mCalibrationLedBackup == nullptr )
-    {
-        mCalibrationLedBackup = new int32_t[ lLedPwrCount ];
-    }
-
-    mCalibrationLedBackup = new int32_t[lLedPwrCount];
-    memcpy( mCalibrationLedBackup, lOutputBuffer, lLedPwrCount * sizeof( int32_t ) );
+    delete[] mCalibrationLedBackup;
+    mCalibrationLedBackup = new int32_t[ lLedPwrCount ];
+    memcpy( mCalibrationLedBackup, &lAdvImage[ lRanges[ 1 ].mOffset ], lLedPwrCount * sizeof( int32_t ) );
     LeddarCore::LdFloatProperty *lCompensationProp = GetProperties()->GetFloatProperty( LeddarCore::LdPropertyIds::ID_INTENSITY_COMPENSATIONS );
     lCompensationProp->SetScale( lDistanceScale );
     lCompensationProp->SetCount( lLedPwrCount );
@@ -930,7 +1066,6 @@ LdSensorVu::GetEchoes()
         uint32_t lTimeStamp = 0;
         uint16_t lEchoCount = 0;
         uint16_t lCurrentLwdPower = 0;
-        uint16_t lEchoCountToRead = 0;
         //Static variables for robustness in a rare case where comm is stuck (only with a FTDI/SPI cable)
         //And we need to reset the transfer mode
         static int sStuckCounter = 0;
@@ -942,24 +1077,16 @@ LdSensorVu::GetEchoes()
         {
             uint8_t lMode = 2;
             mConnectionUniversal->WriteRegister( GetBankAddress( REGMAP_TRN_CFG ) + offsetof( sTransactionCfg, mTransferMode ), &lMode, 1, 5 );
+            ++mConnectionUniversal->GetTransportCounters().mTransferModeResets;
             mErrorFlag = false;
         }
 
         // Get the timestamp and the echoes number
         mConnectionUniversal->Read( 0xb, GetBankAddress( REGMAP_CMD_LIST ) + offsetof( sCmdList, mDetectionReady ), sizeof( ( ( sCmdList * )0 )->mDetectionReady ), 1 );
 
-        if( lOutputBuffer[ 0 ] == 1 )
-        {
-            mConnectionUniversal->Read( 0xb, GetBankAddress( REGMAP_DETECTIONS ), offsetof( sDetections, mEchoes ), 1 );
-            lTimeStamp = *( reinterpret_cast<uint32_t *>( lOutputBuffer + offsetof( sDetections, mTimestamp ) ) );
-            lEchoCount = *( reinterpret_cast<uint16_t *>( lOutputBuffer + offsetof( sDetections, mNbDetection ) ) );
-            lCurrentLwdPower = *( reinterpret_cast<uint16_t *>( lOutputBuffer + offsetof( sDetections, mCurrentUsrLedPower ) ) );
-            lEchoCountToRead = lEchoCount;
-            sStuckMax = sStuckCounter;
-            sStuckCounter = 0;
-        }
-        else
+        if( lOutputBuffer[ 0 ] != 1 )
         {
+            ++mConnectionUniversal->GetTransportCounters().mNotReadyPolls;
             sStuckCounter++;
 
             if( sStuckMax >= 0 && sStuckCounter > sStuckMax * 10 && sStuckCounter > sStuckMax + 10 )
@@ -971,44 +1098,92 @@ LdSensorVu::GetEchoes()
             return false;
         }
 
-        if( lEchoCount > ( lMaxEchoes ) )
-        {
-            return false;
-        }
+        sStuckMax = sStuckCounter;
+        sStuckCounter = 0;
 
-        if( lResultEchoes->GetTimestamp( LeddarConnection::B_GET ) != lTimeStamp )
+        // Read the header. With the combined read, the echoes are read in the same transaction,
+        // as many as in the previous frame. If there are more, the rest is read after.
+        const uint32_t lDetectionsAddr = GetBankAddress( REGMAP_DETECTIONS );
+        uint16_t lEchoesInHeaderRead = 0;
+
+        if( mCombinedEchoRead )
         {
-            lResultEchoes->SetTimestamp( lTimeStamp );
-            uint32_t lEchoStartAddr = GetBankAddress( REGMAP_DETECTIONS ) + offsetof( sDetections, mEchoes );
+            lEchoesInHeaderRead = std::min( mLastEchoCount, lMaxEchoes );
+            const uint32_t lSize = static_cast<uint32_t>( offsetof( sDetections, mEchoes ) + sizeof( sEchoLigth ) * lEchoesInHeaderRead );
 
-            // Get echoes. If the size is over 512 bytes, do multiple read.
-            while( lEchoCountToRead > 0 )
+            // Room for the transaction overhead of the connection
+            if( mConnectionUniversal->GetInternalBuffersSize() < lSize + 64 )
             {
-                uint16_t lEchoCountToReadNow = lEchoCountToRead;
+                mConnectionUniversal->ResizeInternalBuffers( lSize + 64 );
+                mConnectionUniversal->InternalBuffers( lInputBuffer, lOutputBuffer );
+            }
 
-                if( sizeof( sEchoLigth )* lEchoCountToReadNow > 512 )
-                {
-                    lEchoCountToReadNow = 512 / sizeof( sEchoLigth );
-                    lEchoCountToRead -= lEchoCountToReadNow;
-                }
-                else
+            try
+            {
+                mConnectionUniversal->Read( 0xb, lDetectionsAddr, lSize, 1 );
+                mCombinedReadFailures = 0;
+            }
+            catch( LeddarException::LtTimeoutException & )
+            {
+                throw;
+            }
+            catch( LeddarException::LtComException & )
+            {
+                if( lEchoesInHeaderRead == 0 )
                 {
-                    lEchoCountToRead -= lEchoCountToReadNow;
+                    throw;
                 }
 
-                mConnectionUniversal->Read( 0xb, lEchoStartAddr, sizeof( sEchoLigth )* lEchoCountToReadNow, 1, 5000 );
-                sEchoLigth *lDetections = reinterpret_cast<sEchoLigth *>( lOutputBuffer );
-                std::vector<LdEcho> *lEchoes = lResultEchoes->GetEchoes( LeddarConnection::B_SET );
+                // Retry with the header only. A link error (CRC...) fails it too and is not counted,
+                // only failures of the larger read alone tell the firmware does not accept it.
+                lEchoesInHeaderRead = 0;
+                mConnectionUniversal->Read( 0xb, lDetectionsAddr, offsetof( sDetections, mEchoes ), 1 );
 
-                for( int i = 0; i < lEchoCountToReadNow; ++i )
+                if( ++mCombinedReadFailures >= MAX_COMBINED_READ_FAILURES )
                 {
-                    ( *lEchoes )[ i ].mChannelIndex = lDetections[ i ].mSegment;
-                    ( *lEchoes )[ i ].mDistance = lDetections[ i ].mDistance;
-                    ( *lEchoes )[ i ].mAmplitude = lDetections[ i ].mAmplitude;
-                    ( *lEchoes )[ i ].mFlag = lDetections[ i ].mFlag;
+                    mCombinedEchoRead = false;
                 }
             }
+        }
+        else
+        {
+            mConnectionUniversal->Read( 0xb, lDetectionsAddr, offsetof( sDetections, mEchoes ), 1 );
+        }
+
+        lTimeStamp = *( reinterpret_cast<uint32_t *>( lOutputBuffer + offsetof( sDetections, mTimestamp ) ) );
+        lEchoCount = *( reinterpret_cast<uint16_t *>( lOutputBuffer + offsetof( sDetections, mNbDetection ) ) );
+        lCurrentLwdPower = *( reinterpret_cast<uint16_t *>( lOutputBuffer + offsetof( sDetections, mCurrentUsrLedPower ) ) );
+
+        if( lEchoCount > ( lMaxEchoes ) )
+        {
+            return false;
+        }
+
+        if( lResultEchoes->GetTimestamp( LeddarConnection::B_GET ) != lTimeStamp )
+        {
+            lResultEchoes->SetTimestamp( lTimeStamp );
+            std::vector<LdEcho> &lEchoes = *lResultEchoes->GetEchoes( LeddarConnection::B_SET );
+
+            LT_TIMING_BEGIN( lStart );
+            uint16_t lEchoesDone = std::min( lEchoCount, lEchoesInHeaderRead );
+            DecodeEchoes( lOutputBuffer + offsetof( sDetections, mEchoes ), lEchoes, 0, lEchoesDone );
+            LT_TIMING_END( &mTimingStats, TS_DECODE, lStart );
+
+            // Get the other echoes in one block, read in chunks of 512 bytes.
+            if( lEchoesDone < lEchoCount )
+            {
+                const uint16_t lRemaining = lEchoCount - lEchoesDone;
+                mEchoReadBuffer.resize( sizeof( sEchoLigth ) * lMaxEchoes );
+
+                mConnectionUniversal->ReadBlock( lDetectionsAddr + static_cast<uint32_t>( offsetof( sDetections, mEchoes ) + sizeof( sEchoLigth ) * lEchoesDone ),
+                                                 &mEchoReadBuffer[0], static_cast<uint32_t>( sizeof( sEchoLigth ) * lRemaining ), 1, 5000, MAX_ECHO_READ_SIZE );
+                LT_TIMING_BEGIN( lStartChunk );
+                DecodeEchoes( &mEchoReadBuffer[0], lEchoes, lEchoesDone, lRemaining );
+                LT_TIMING_END( &mTimingStats, TS_DECODE, lStartChunk );
+            }
 
+            mLastEchoCount = lEchoCount;
+            lResultEchoes->SetHostTimestamp( LeddarUtils::LtTimeUtils::GetMonotonicNanoseconds() );
             lResultEchoes->SetEchoCount( lEchoCount );
             lResultEchoes->SetCurrentLedPower( lCurrentLwdPower );
         }
@@ -1339,6 +1514,8 @@ LdSensorVu::ResetToDefaultWithoutWriteEnable( int16_t aCRCTry )
             throw std::runtime_error( "Error to erease chip (write enable)." );
         }
 
+        mCfgImage.clear();
+        mTempCompImage.clear();
         mConnectionUniversal->Write( REGMAP_CE, 0, 0, aCRCTry, 0, 0, 5000 );
         mConnectionUniversal->IsDeviceReady( 4000 );
     }
@@ -1380,6 +1557,8 @@ LdSensorVu::ResetToDefault()
 void
 LdSensorVu::Reset( LeddarDefines::eResetType aType, LeddarDefines::eResetOptions )
 {
+    mCfgImage.clear();
+    mTempCompImage.clear();
     mConnectionUniversal->Reset( aType, 0 );
 }
 
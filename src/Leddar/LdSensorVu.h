@@ -21,6 +21,8 @@
 #include "LdCarrierEnhancedModbus.h"
 #include "LdConnectionUniversal.h"
 
+#include <vector>
+
 namespace LeddarDevice
 {
 
@@ -55,6 +57,8 @@ namespace LeddarDevice
         void                                        DeleteBackup( void );
 
         void                                        SetTransferMode( eTransfertMode aMode );
+        void                                        SetCombinedEchoRead( bool aEnable ) { mCombinedEchoRead = aEnable; mCombinedReadFailures = 0; }
+        bool                                        IsCombinedEchoRead( void ) const { return mCombinedEchoRead; }
         static uint32_t                             GetBankAddress( uint8_t aBankType );
 
 #ifdef BUILD_MODBUS
@@ -79,6 +83,12 @@ namespace LeddarDevice
 #endif
         bool                                       mErrorFlag;
         bool                                       mBackupFlagAvailable;
+        bool                                       mCombinedEchoRead;      ///< Read the detection header and the echoes in one transaction
+        uint8_t                                    mCombinedReadFailures;  ///< Consecutive combined read failures where the header only read worked, falls back to separate reads after a few
+        uint16_t                                   mLastEchoCount;         ///< Echo count of the previous frame, size of the next combined read
+        std::vector<uint8_t>                       mEchoReadBuffer;        ///< Destination of the echoes read after the header
+        std::vector<uint8_t>                       mCfgImage;              ///< Configuration bank as last read or written, empty if unknown
+        std::vector<uint8_t>                       mTempCompImage;         ///< Reference distance and temperature enables as last read or written, empty if unknown
     };
 }
 
@@ -568,7 +568,7 @@ bool LeddarDevice::LdSensorVu8Can::GetEchoes( void )
             if( !mProtocol->ReadDetectionAnswer() )
             {
                 --lTimeout;
-                LeddarUtils::LtTimeUtils::Wait( 1 );
+                mProtocol->WaitForData( 1 );
                 continue;
             }
 
@@ -600,7 +600,7 @@ bool LeddarDevice::LdSensorVu8Can::GetEchoes( void )
             if( !mProtocol->ReadDetectionAnswer() )
             {
                 --lTimeout;
-                LeddarUtils::LtTimeUtils::Wait( 1 );
+                mProtocol->WaitForData( 1 );
                 continue;
             }
 
@@ -636,6 +636,7 @@ bool LeddarDevice::LdSensorVu8Can::GetEchoes( void )
     }
 
     mEchoes.SetCurrentLedPower( lCrurrentLedPower );
+    mEchoes.SetHostTimestamp( mProtocol->GetDetectionTimestamp() ); //Reception time of the last frame of the echo set
     mEchoes.SetTimestamp( lTimestamp );
     mEchoes.UnLock( LeddarConnection::B_SET );
 
@@ -43,7 +43,7 @@ using namespace LeddarDevice;
 /// \brief   Constructor - Take ownership of aConnection (and the 2 pointers used to build it)
 ///
 /// \param   aConnection Associated connection for the LeddarVu8 Modbus.
-///          The connection must be a child of LdLibModbusSerial interface.
+///          The connection must be a child of LdInterfaceModbus interface (serial or TCP).
 ///
 /// \author  Patrick Boulay
 ///
@@ -58,7 +58,7 @@ LdSensorVu8Modbus::LdSensorVu8Modbus( LeddarConnection::LdConnection *aConnectio
     if( aConnection != nullptr )
     {
         mConnectionInfoModbus = dynamic_cast< const LeddarConnection::LdConnectionInfoModbus * >( aConnection->GetConnectionInfo() );
-        mInterface = dynamic_cast< LeddarConnection::LdLibModbusSerial * >( aConnection );
+        mInterface = dynamic_cast< LeddarConnection::LdInterfaceModbus * >( aConnection );
     }
 
     InitProperties();
@@ -196,7 +196,6 @@ LdSensorVu8Modbus::GetConfig( void )
     //Get sensor config values
     uint16_t lResponse2[LTMODBUS_RTU_MAX_ADU_LENGTH / 2] = { 0 };
     mInterface->ReadRegisters( 0, 3, lResponse2 );
-    LeddarUtils::LtTimeUtils::WaitBlockingMicro( LEDDARVU8_WAIT_AFTER_REQUEST );
     GetProperties()->GetIntegerProperty( LeddarCore::LdPropertyIds::ID_ACCUMULATION_EXP )->SetValue( 0, lResponse2[0] );
     GetProperties()->GetIntegerProperty( LeddarCore::LdPropertyIds::ID_ACCUMULATION_EXP )->SetClean();
     GetProperties()->GetIntegerProperty( LeddarCore::LdPropertyIds::ID_OVERSAMPLING_EXP )->SetValue( 0, lResponse2[1] );
@@ -206,7 +205,6 @@ LdSensorVu8Modbus::GetConfig( void )
 
     memset( lResponse2, 0, LTMODBUS_RTU_MAX_ADU_LENGTH );
     mInterface->ReadRegisters( 4, 4, lResponse2 );
-    LeddarUtils::LtTimeUtils::WaitBlockingMicro( LEDDARVU8_WAIT_AFTER_REQUEST );
     GetProperties()->GetFloatProperty( LeddarCore::LdPropertyIds::ID_SENSIVITY )->SetRawValue( 0, static_cast<int16_t>( lResponse2[0] ) );
     GetProperties()->GetFloatProperty( LeddarCore::LdPropertyIds::ID_SENSIVITY )->SetClean();
     GetProperties()->GetEnumProperty( LeddarCore::LdPropertyIds::ID_LED_INTENSITY )->SetValue( 0, lResponse2[1] );
@@ -218,13 +216,11 @@ LdSensorVu8Modbus::GetConfig( void )
 
     memset( lResponse2, 0, LTMODBUS_RTU_MAX_ADU_LENGTH );
     mInterface->ReadRegisters( 9, 1, lResponse2 );
-    LeddarUtils::LtTimeUtils::WaitBlockingMicro( LEDDARVU8_WAIT_AFTER_REQUEST );
     GetProperties()->GetIntegerProperty( LeddarCore::LdPropertyIds::ID_LED_AUTO_ECHO_AVG )->SetValue( 0, lResponse2[0] );
     GetProperties()->GetIntegerProperty( LeddarCore::LdPropertyIds::ID_LED_AUTO_ECHO_AVG )->SetClean();
 
     memset( lResponse2, 0, LTMODBUS_RTU_MAX_ADU_LENGTH );
     mInterface->ReadRegisters( 11, 3, lResponse2 );
-    LeddarUtils::LtTimeUtils::WaitBlockingMicro( LEDDARVU8_WAIT_AFTER_REQUEST );
     GetProperties()->GetIntegerProperty( LeddarCore::LdPropertyIds::ID_PRECISION )->SetValue( 0, static_cast<int16_t>( lResponse2[0] ) );
     GetProperties()->GetIntegerProperty( LeddarCore::LdPropertyIds::ID_PRECISION )->SetClean();
     GetProperties()->GetBitProperty( LeddarCore::LdPropertyIds::ID_SEGMENT_ENABLE )->SetValue( 0, lResponse2[1] );
@@ -262,7 +258,6 @@ LdSensorVu8Modbus::GetConstants( void )
 
     mInterface->SendRawRequest( lRawRequest, 2 );
     size_t lReceivedSize = mInterface->ReceiveRawConfirmation( lResponse, 0 );
-    LeddarUtils::LtTimeUtils::WaitBlockingMicro( LEDDARVU8_WAIT_AFTER_REQUEST );
 
     if( lReceivedSize < sizeof( LtComLeddarVu8Modbus::sLeddarVu8ModbusServerId ) )
     {
@@ -588,7 +583,6 @@ LdSensorVu8Modbus::SetConfig( void )
 
             mInterface->WriteRegister( ( *lPropertyIter )->GetDeviceId(), lValue );
             ( *lPropertyIter )->SetClean();
-            LeddarUtils::LtTimeUtils::WaitBlockingMicro( LEDDARVU8_WAIT_AFTER_REQUEST );
         }
     }
 
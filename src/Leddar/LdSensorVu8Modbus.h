@@ -19,7 +19,7 @@
 
 #include "LdSensor.h"
 #include "LdConnectionInfoModbus.h"
-#include "LdLibModbusSerial.h"
+#include "LdInterfaceModbus.h"
 
 namespace LeddarDevice
 {
@@ -48,7 +48,7 @@ namespace LeddarDevice
         void            SetCanConfig( void );
 
         const LeddarConnection::LdConnectionInfoModbus  *mConnectionInfoModbus;
-        LeddarConnection::LdLibModbusSerial *mInterface;
+        LeddarConnection::LdInterfaceModbus *mInterface;
 
     private:
         void            InitProperties( void );
@@ -0,0 +1,266 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \file   Leddar/LdTimingStats.cpp
+///
+/// \brief  Implements the LdTimingHistogram and LdTimingStats classes.
+///
+/// Copyright (c) 2018 LeddarTech. All rights reserved.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "LdTimingStats.h"
+
+#include <stdexcept>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn LeddarConnection::LdTimingHistogram::LdTimingHistogram( void )
+///
+/// \brief  Constructor.
+///
+/// \author David Levy
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+LeddarConnection::LdTimingHistogram::LdTimingHistogram( void )
+{
+    Reset();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LeddarConnection::LdTimingHistogram::Add( uint64_t aNanoseconds )
+///
+/// \brief  Add a duration to the histogram.
+///
+/// \param  aNanoseconds    The duration in nanoseconds.
+///
+/// \author David Levy
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void
+LeddarConnection::LdTimingHistogram::Add( uint64_t aNanoseconds )
+{
+    mBuckets[GetBucket( aNanoseconds )].fetch_add( 1, std::memory_order_relaxed );
+    mSum.fetch_add( aNanoseconds, std::memory_order_relaxed );
+    mCount.fetch_add( 1, std::memory_order_relaxed );
+
+    uint64_t lMax = mMax.load( std::memory_order_relaxed );
+
+    while( aNanoseconds > lMax && !mMax.compare_exchange_weak( lMax, aNanoseconds, std::memory_order_relaxed ) )
+    {
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LeddarConnection::LdTimingHistogram::Reset( void )
+///
+/// \brief  Clear the histogram. Durations added during the reset can be partially lost.
+///
+/// \author David Levy
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void
+LeddarConnection::LdTimingHistogram::Reset( void )
+{
+    for( size_t i = 0; i < BUCKET_COUNT; ++i )
+    {
+        mBuckets[i].store( 0, std::memory_order_relaxed );
+    }
+
+    mCount.store( 0, std::memory_order_relaxed );
+    mSum.store( 0, std::memory_order_relaxed );
+    mMax.store( 0, std::memory_order_relaxed );
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn uint64_t LeddarConnection::LdTimingHistogram::GetMean( void ) const
+///
+/// \brief  Mean duration in nanoseconds, 0 if the histogram is empty.
+///
+/// \author David Levy
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+uint64_t
+LeddarConnection::LdTimingHistogram::GetMean( void ) const
+{
+    uint64_t lCount = mCount;
+    return lCount == 0 ? 0 : mSum / lCount;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn uint64_t LeddarConnection::LdTimingHistogram::GetPercentile( double aPercentile ) const
+///
+/// \brief  Duration under which aPercentile % of the durations are (upper bound of the bucket, capped to the maximum).
+///
+/// \exception  std::out_of_range   Thrown if aPercentile is not in [0, 100].
+///
+/// \param  aPercentile The percentile (50 for the median).
+///
+/// \return The duration in nanoseconds, 0 if the histogram is empty.
+///
+/// \author David Levy
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+uint64_t
+LeddarConnection::LdTimingHistogram::GetPercentile( double aPercentile ) const
+{
+    if( aPercentile < 0 || aPercentile > 100 )
+    {
+        throw std::out_of_range( "Percentile must be between 0 and 100." );
+    }
+
+    uint64_t lCounts[BUCKET_COUNT];
+    uint64_t lTotal = 0;
+
+    for( size_t i = 0; i < BUCKET_COUNT; ++i )
+    {
+        lCounts[i] = mBuckets[i].load( std::memory_order_relaxed );
+        lTotal += lCounts[i];
+    }
+
+    if( lTotal == 0 )
+    {
+        return 0;
+    }
+
+    uint64_t lRank = static_cast<uint64_t>( aPercentile / 100.0 * lTotal + 0.5 );
+
+    if( lRank == 0 )
+    {
+        lRank = 1;
+    }
+
+    uint64_t lMax = mMax;
+    uint64_t lCumulative = 0;
+
+    for( size_t i = 0; i < BUCKET_COUNT; ++i )
+    {
+        lCumulative += lCounts[i];
+
+        if( lCumulative >= lRank )
+        {
+            uint64_t lBound = GetBucketUpperBound( i );
+            return lBound < lMax ? lBound : lMax;
+        }
+    }
+
+    return lMax;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn size_t LeddarConnection::LdTimingHistogram::GetBucket( uint64_t aNanoseconds )
+///
+/// \brief  Index of the bucket of a duration. Values under 2^SUB_BUCKET_BITS have their own bucket, then each power of two
+///         is split in 2^SUB_BUCKET_BITS buckets.
+///
+/// \author David Levy
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+size_t
+LeddarConnection::LdTimingHistogram::GetBucket( uint64_t aNanoseconds )
+{
+    const uint64_t lSubBucketCount = 1ULL << SUB_BUCKET_BITS;
+
+    if( aNanoseconds < lSubBucketCount )
+    {
+        return static_cast<size_t>( aNanoseconds );
+    }
+
+    size_t lMsb = 0;
+
+    for( uint64_t lValue = aNanoseconds; lValue > 1; lValue >>= 1 )
+    {
+        ++lMsb;
+    }
+
+    size_t lSubBucket = static_cast<size_t>( ( aNanoseconds >> ( lMsb - SUB_BUCKET_BITS ) ) & ( lSubBucketCount - 1 ) );
+    return ( ( lMsb - SUB_BUCKET_BITS + 1 ) << SUB_BUCKET_BITS ) + lSubBucket;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn uint64_t LeddarConnection::LdTimingHistogram::GetBucketUpperBound( size_t aBucket )
+///
+/// \brief  Largest duration of a bucket (see GetBucket).
+///
+/// \author David Levy
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+uint64_t
+LeddarConnection::LdTimingHistogram::GetBucketUpperBound( size_t aBucket )
+{
+    const uint64_t lSubBucketCount = 1ULL << SUB_BUCKET_BITS;
+
+    if( aBucket < lSubBucketCount )
+    {
+        return aBucket;
+    }
+
+    size_t lMsb = ( aBucket >> SUB_BUCKET_BITS ) + SUB_BUCKET_BITS - 1;
+    uint64_t lSubBucket = aBucket & ( lSubBucketCount - 1 );
+    uint64_t lLowerBound = ( lSubBucketCount + lSubBucket ) << ( lMsb - SUB_BUCKET_BITS );
+    return lLowerBound + ( 1ULL << ( lMsb - SUB_BUCKET_BITS ) ) - 1;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LeddarConnection::LdTimingStats::Reset( void )
+///
+/// \brief  Clear the histograms of all stages.
+///
+/// \author David Levy
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void
+LeddarConnection::LdTimingStats::Reset( void )
+{
+    for( size_t i = 0; i < TS_COUNT; ++i )
+    {
+        mHistograms[i].Reset();
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn const char *LeddarConnection::LdTimingStats::GetStageName( eStage aStage )
+///
+/// \brief  Name of a stage, for display.
+///
+/// \author David Levy
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+const char *
+LeddarConnection::LdTimingStats::GetStageName( eStage aStage )
+{
+    switch( aStage )
+    {
+        case TS_TRANSPORT_READ:
+            return "transport_read";
+
+        case TS_DECODE:
+            return "decode";
+
+        case TS_SWAP:
+            return "swap";
+
+        case TS_DISPATCH:
+            return "dispatch";
+
+        default:
+            throw std::out_of_range( "Invalid timing stage." );
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void LeddarConnection::LdTimingStats::Record( LdTimingStats *aStats, eStage aStage, uint64_t aStart )
+///
+/// \brief  Add the time elapsed since aStart to a stage. Does nothing if aStats is null. Use LT_TIMING_END.
+///
+/// \param [in,out] aStats  The stats, can be null.
+/// \param          aStage  The stage.
+/// \param          aStart  Start time (LT_TIMING_BEGIN).
+///
+/// \author David Levy
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void
+LeddarConnection::LdTimingStats::Record( LdTimingStats *aStats, eStage aStage, uint64_t aStart )
+{
+    if( aStats != nullptr )
+    {
+        aStats->mHistograms[aStage].Add( LeddarUtils::LtTimeUtils::GetMonotonicNanoseconds() - aStart );
+    }
+}
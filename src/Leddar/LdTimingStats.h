@@ -0,0 +1,104 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \file   Leddar/LdTimingStats.h
+///
+/// \brief  Declares the LdTimingHistogram and LdTimingStats classes.
+///     Timing of each stage of the acquisition of a frame (transport read, decode, swap, signal dispatch).
+///     Only recorded when BUILD_TIMING_STATS is defined (LtDefines.h), the LT_TIMING_xxx macros are empty otherwise.
+///
+/// Copyright (c) 2018 LeddarTech. All rights reserved.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "LtDefines.h"
+#include "LtTimeUtils.h"
+
+#include <atomic>
+#include <stdint.h>
+
+#ifdef BUILD_TIMING_STATS
+#define LT_TIMING_BEGIN( aName ) const uint64_t aName = LeddarUtils::LtTimeUtils::GetMonotonicNanoseconds()
+#define LT_TIMING_END( aStats, aStage, aName ) LeddarConnection::LdTimingStats::Record( aStats, LeddarConnection::LdTimingStats::aStage, aName )
+#else
+#define LT_TIMING_BEGIN( aName )
+#define LT_TIMING_END( aStats, aStage, aName )
+#endif
+
+namespace LeddarConnection
+{
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \class  LdTimingHistogram
+    ///
+    /// \brief  Lock-free histogram of durations in nanoseconds.
+    ///
+    ///         Buckets are logarithmic with 4 sub-buckets per power of two, so percentiles are accurate within 25%.
+    ///         The maximum is exact. Add can be called from any thread, reads do not block the writers.
+    ///
+    /// \author David Levy
+    /// \date   October 2026
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    class LdTimingHistogram
+    {
+    public:
+        static const size_t SUB_BUCKET_BITS = 2;
+        static const size_t BUCKET_COUNT = ( 64 - SUB_BUCKET_BITS + 1 ) << SUB_BUCKET_BITS;
+
+        LdTimingHistogram( void );
+
+        void        Add( uint64_t aNanoseconds );
+        void        Reset( void );
+        uint64_t    GetCount( void ) const { return mCount; }
+        uint64_t    GetMax( void ) const { return mMax; }
+        uint64_t    GetMean( void ) const;
+        uint64_t    GetPercentile( double aPercentile ) const;
+
+    private:
+        LdTimingHistogram( const LdTimingHistogram &aHistogram ); //Disable copy constructor
+        LdTimingHistogram &operator=( const LdTimingHistogram &aHistogram ); //Disable equal operator
+
+        static size_t   GetBucket( uint64_t aNanoseconds );
+        static uint64_t GetBucketUpperBound( size_t aBucket );
+
+        std::atomic<uint64_t> mBuckets[BUCKET_COUNT];
+        std::atomic<uint64_t> mCount;
+        std::atomic<uint64_t> mSum;
+        std::atomic<uint64_t> mMax;
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \class  LdTimingStats
+    ///
+    /// \brief  One timing histogram per acquisition stage. Owned by the sensor (LdSensor::GetTimingStats),
+    ///         its connections and result providers record into it.
+    ///
+    /// \author David Levy
+    /// \date   October 2026
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    class LdTimingStats
+    {
+    public:
+        enum eStage
+        {
+            TS_TRANSPORT_READ,  ///< Read of the data from the transport (LdConnectionUniversalSpi::Read, LdProtocolLeddarTech::ReadRequest)
+            TS_DECODE,          ///< Decode of the data into the result providers
+            TS_SWAP,            ///< Publication of the echoes frame (LdResultEchoes::Swap)
+            TS_DISPATCH,        ///< NEW_DATA signal emission (synchronous callbacks included)
+            TS_COUNT
+        };
+
+        LdTimingStats( void ) {}
+
+        LdTimingHistogram       &GetHistogram( eStage aStage ) { return mHistograms[aStage]; }
+        const LdTimingHistogram &GetHistogram( eStage aStage ) const { return mHistograms[aStage]; }
+        void                    Reset( void );
+        static const char      *GetStageName( eStage aStage );
+
+        static void Record( LdTimingStats *aStats, eStage aStage, uint64_t aStart );
+
+    private:
+        LdTimingStats( const LdTimingStats &aStats ); //Disable copy constructor
+        LdTimingStats &operator=( const LdTimingStats &aStats ); //Disable equal operator
+
+        LdTimingHistogram mHistograms[TS_COUNT];
+    };
+}
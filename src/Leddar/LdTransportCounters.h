@@ -0,0 +1,80 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \file   Leddar/LdTransportCounters.h
+///
+/// \brief  Declares the LdTransportCounters class, statistics of a connection (see LdConnection::GetTransportStats).
+///
+/// Copyright (c) 2018 LeddarTech. All rights reserved.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <atomic>
+#include <stdint.h>
+
+namespace LeddarConnection
+{
+    typedef struct sTransportStats
+    {
+        uint64_t mBytesIn;              ///< Bytes received from the sensor
+        uint64_t mBytesOut;             ///< Bytes sent to the sensor
+        uint64_t mTransactions;         ///< Transactions (one request and its answer, retries included)
+        uint64_t mCrcFailures;          ///< Transactions that failed the CRC or integrity check
+        uint64_t mCrcRetries;           ///< Transactions retried after a failure
+        uint64_t mTimeouts;             ///< Operations that timed out
+        uint64_t mTransferModeResets;   ///< Transfer mode resets done to recover a stuck link
+        uint64_t mNotReadyPolls;        ///< Polls that found the sensor busy or without new data
+    } sTransportStats;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \class  LdTransportCounters
+    ///
+    /// \brief  Counters updated by the connection on each transaction. They can be read from any thread.
+    ///
+    /// \author David Levy
+    /// \date   October 2026
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    class LdTransportCounters
+    {
+    public:
+        LdTransportCounters( void ) { Reset(); }
+
+        void Reset( void )
+        {
+            mBytesIn = 0;
+            mBytesOut = 0;
+            mTransactions = 0;
+            mCrcFailures = 0;
+            mCrcRetries = 0;
+            mTimeouts = 0;
+            mTransferModeResets = 0;
+            mNotReadyPolls = 0;
+        }
+
+        sTransportStats GetStats( void ) const
+        {
+            sTransportStats lStats;
+            lStats.mBytesIn = mBytesIn;
+            lStats.mBytesOut = mBytesOut;
+            lStats.mTransactions = mTransactions;
+            lStats.mCrcFailures = mCrcFailures;
+            lStats.mCrcRetries = mCrcRetries;
+            lStats.mTimeouts = mTimeouts;
+            lStats.mTransferModeResets = mTransferModeResets;
+            lStats.mNotReadyPolls = mNotReadyPolls;
+            return lStats;
+        }
+
+        std::atomic<uint64_t> mBytesIn;
+        std::atomic<uint64_t> mBytesOut;
+        std::atomic<uint64_t> mTransactions;
+        std::atomic<uint64_t> mCrcFailures;
+        std::atomic<uint64_t> mCrcRetries;
+        std::atomic<uint64_t> mTimeouts;
+        std::atomic<uint64_t> mTransferModeResets;
+        std::atomic<uint64_t> mNotReadyPolls;
+
+    private:
+        LdTransportCounters( const LdTransportCounters &aCounters ); //Disable copy constructor
+        LdTransportCounters &operator=( const LdTransportCounters &aCounters ); //Disable equal operator
+    };
+}
@@ -0,0 +1,236 @@
+// *****************************************************************************
+// LeddarBench.cpp
+// Benchmark of the property lookups done when a sensor decodes a message.
+// Builds the property set of a M16 sensor (no sensor needed) and times
+// LdPropertiesContainer::FindDeviceProperty and the decoding of a states
+// message with LdProtocolLeddarTech::ReadElementToProperties.
+// Also times LdObject::EmitSignal as the number of receivers grows.
+//
+// Usage: LeddarBench [iterations]
+//
+// *****************************************************************************
+
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+#include "LdObject.h"
+#include "LdPropertiesContainer.h"
+#include "LdProtocolLeddarTech.h"
+#include "LdSensorM16.h"
+
+#include "comm/LtComLeddarTechPublic.h"
+
+/// Interface without a sensor behind it, the protocol needs one to decode
+class LdBenchInterface : public LeddarConnection::LdConnection
+{
+public:
+    LdBenchInterface( void ) : LdConnection( nullptr, nullptr ) {}
+
+    virtual void Connect( void ) override {}
+    virtual void Disconnect( void ) override {}
+    virtual bool IsConnected( void ) const override { return true; }
+};
+
+/// Protocol that decodes a message prepared in memory instead of reading it from a sensor
+class LdBenchProtocol : public LeddarConnection::LdProtocolLeddarTech
+{
+public:
+    explicit LdBenchProtocol( LeddarConnection::LdConnection *aInterface ) : LdProtocolLeddarTech( nullptr, aInterface ) { SetConnected( true ); }
+
+    virtual void ReadAnswer( void ) override {}
+
+    /// Build a message with one element per property of aProperties that has a device id
+    void BuildMessage( uint16_t aRequestCode, const LeddarCore::LdPropertiesContainer *aProperties )
+    {
+        StartRequest( aRequestCode );
+
+        for( std::map<uint32_t, LeddarCore::LdProperty *>::const_iterator it = aProperties->GetContent()->begin(); it != aProperties->GetContent()->end(); ++it )
+        {
+            const LeddarCore::LdProperty *lProperty = it->second;
+
+            if( lProperty->GetDeviceId() != 0 )
+            {
+                AddElement( static_cast<uint16_t>( lProperty->GetDeviceId() ), static_cast<uint16_t>( lProperty->Count() ), lProperty->UnitSize(), lProperty->CStorage(),
+                            lProperty->UnitSize() );
+            }
+        }
+
+        memcpy( mTransferOutputBuffer, mTransferInputBuffer, *mTotalMessageSize );
+    }
+
+protected:
+    virtual void Read( uint32_t /*aSize*/ ) override {} //The message is already in mTransferOutputBuffer
+};
+
+static double
+ElapsedNs( std::chrono::steady_clock::time_point aStart, size_t aCount )
+{
+    return static_cast<double>( std::chrono::duration_cast<std::chrono::nanoseconds>( std::chrono::steady_clock::now() - aStart ).count() ) / static_cast<double>( aCount );
+}
+
+/// Sender of the signals timed by the bench
+class LdBenchEmitter : public LeddarCore::LdObject
+{
+public:
+    void Emit( void ) { EmitSignal( LeddarCore::LdObject::NEW_DATA ); }
+};
+
+/// Receiver that only counts the callbacks
+class LdBenchReceiver : public LeddarCore::LdObject
+{
+public:
+    LdBenchReceiver( void ) : mCalls( 0 ) {}
+
+    virtual void Callback( LdObject * /*aSender*/, const SIGNALS /*aSignal*/, void * /*aExtraData*/ ) override { ++mCalls; }
+
+    size_t mCalls;
+};
+
+/// Time NEW_DATA emissions to aReceivers receivers, while aOthers receivers are connected to another signal
+static void
+BenchEmitSignal( size_t aReceivers, size_t aOthers, size_t aIterations )
+{
+    LdBenchEmitter lEmitter;
+    std::vector<LdBenchReceiver> lReceivers( aReceivers + aOthers );
+
+    for( size_t i = 0; i < lReceivers.size(); ++i )
+    {
+        lEmitter.ConnectSignal( &lReceivers[i], i < aReceivers ? LeddarCore::LdObject::NEW_DATA : LeddarCore::LdObject::VALUE_CHANGED );
+    }
+
+    std::chrono::steady_clock::time_point lStart = std::chrono::steady_clock::now();
+
+    for( size_t i = 0; i < aIterations; ++i )
+    {
+        lEmitter.Emit();
+    }
+
+    double lElapsed = ElapsedNs( lStart, aIterations );
+
+    std::cout << "EmitSignal, " << std::setw( 3 ) << aReceivers << " receivers (" << std::setw( 3 ) << aOthers << " on another signal): " << lElapsed
+              << " ns / emission" << std::endl;
+}
+
+/// Device id search the way FindDeviceProperty did it before the index, for reference
+static LeddarCore::LdProperty *
+LinearFindDeviceProperty( const LeddarCore::LdPropertiesContainer *aProperties, uint32_t aDeviceId )
+{
+    for( std::map<uint32_t, LeddarCore::LdProperty *>::const_iterator it = aProperties->GetContent()->begin(); it != aProperties->GetContent()->end(); ++it )
+    {
+        if( it->second->GetDeviceId() == aDeviceId )
+        {
+            return it->second;
+        }
+    }
+
+    return nullptr;
+}
+
+int main( int argc, char *argv[] )
+{
+    const size_t lIterations = argc > 1 ? static_cast<size_t>( strtoul( argv[1], nullptr, 10 ) ) : 100000;
+
+    try
+    {
+        LeddarDevice::LdSensorM16 lSensor( nullptr );
+        LeddarCore::LdPropertiesContainer *lProperties = lSensor.GetProperties();
+        LeddarCore::LdPropertiesContainer *lStates = lSensor.GetResultStates()->GetProperties();
+
+        std::vector<uint32_t> lDeviceIds;
+
+        for( std::map<uint32_t, LeddarCore::LdProperty *>::const_iterator it = lProperties->GetContent()->begin(); it != lProperties->GetContent()->end(); ++it )
+        {
+            if( it->second->GetDeviceId() != 0 )
+            {
+                lDeviceIds.push_back( it->second->GetDeviceId() );
+            }
+        }
+
+        std::cout << "M16 property set: " << lProperties->GetContent()->size() << " properties, " << lDeviceIds.size() << " device ids" << std::endl;
+        std::cout << std::fixed << std::setprecision( 1 );
+
+        // FindDeviceProperty over every device id of the set
+        size_t lFound = 0;
+        std::chrono::steady_clock::time_point lStart = std::chrono::steady_clock::now();
+
+        for( size_t i = 0; i < lIterations; ++i )
+        {
+            for( size_t j = 0; j < lDeviceIds.size(); ++j )
+            {
+                lFound += lProperties->FindDeviceProperty( lDeviceIds[j] ) != nullptr;
+            }
+        }
+
+        std::cout << "FindDeviceProperty:         " << ElapsedNs( lStart, lIterations * lDeviceIds.size() ) << " ns / lookup" << std::endl;
+
+        lStart = std::chrono::steady_clock::now();
+
+        for( size_t i = 0; i < lIterations; ++i )
+        {
+            for( size_t j = 0; j < lDeviceIds.size(); ++j )
+            {
+                lFound += LinearFindDeviceProperty( lProperties, lDeviceIds[j] ) != nullptr;
+            }
+        }
+
+        std::cout << "Linear search (reference):  " << ElapsedNs( lStart, lIterations * lDeviceIds.size() ) << " ns / lookup" << std::endl;
+
+        // Decoding of a states message, one element per state. The states have no value until the first message.
+        for( std::map<uint32_t, LeddarCore::LdProperty *>::const_iterator it = lStates->GetContent()->begin(); it != lStates->GetContent()->end(); ++it )
+        {
+            if( it->second->GetDeviceId() != 0 && it->second->Count() == 0 )
+            {
+                it->second->SetCount( 1 );
+            }
+        }
+
+        LdBenchInterface lInterface;
+        LdBenchProtocol lProtocol( &lInterface );
+        lProtocol.BuildMessage( LtComLeddarTechPublic::LT_COMM_DATASRV_REQUEST_SEND_STATES, lStates );
+
+        size_t lElements = 0;
+        lProtocol.ReadRequest();
+
+        while( lProtocol.ReadElement() )
+        {
+            ++lElements;
+        }
+
+        lStart = std::chrono::steady_clock::now();
+
+        for( size_t i = 0; i < lIterations; ++i )
+        {
+            lProtocol.ReadRequest();
+            lProtocol.ReadElementToProperties( lStates );
+        }
+
+        std::cout << "States message (" << lElements << " elements): " << ElapsedNs( lStart, lIterations ) << " ns / message" << std::endl;
+
+        // Signal emission, receivers of the emitted signal and of another one
+        const size_t lReceiverCounts[] = { 1, 4, 16, 64 };
+
+        for( size_t i = 0; i < sizeof( lReceiverCounts ) / sizeof( lReceiverCounts[0] ); ++i )
+        {
+            BenchEmitSignal( lReceiverCounts[i], 0, lIterations );
+        }
+
+        BenchEmitSignal( 1, 64, lIterations );
+
+        if( lFound == 0 )
+        {
+            std::cout << "No property found" << std::endl;
+            return 1;
+        }
+    }
+    catch( std::exception &e )
+    {
+        std::cout << "Error: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -1307,7 +1307,6 @@ struct LeddarPyEcho
 };
 PyObject *PackageEchoes( LeddarConnection::LdResultEchoes *aResultEchoes )
 {
-    std::vector<LeddarConnection::LdEcho> &lEchoes = *( aResultEchoes->GetEchoes() );
     npy_intp dimsIndices = aResultEchoes->GetEchoCount();
     PyObject *lEchoesDict = PyDict_New();
 
@@ -1343,12 +1342,13 @@ PyObject *PackageEchoes( LeddarConnection::LdResultEchoes *aResultEchoes )
     for( int i = 0; i < dimsIndices; ++i )
     {
         LeddarPyEcho *ech_ptr = static_cast<LeddarPyEcho *>PyArray_GETPTR1( ( PyArrayObject * )lEchoesArray, i );
+        LeddarConnection::LdEcho lEcho = aResultEchoes->GetEcho( i );
 
-        ech_ptr->index = uint32_t( lEchoes[i].mChannelIndex );
-        ech_ptr->distance = float( lEchoes[i].mDistance ) / aResultEchoes->GetDistanceScale();
-        ech_ptr->amplitude = float( lEchoes[i].mAmplitude ) / aResultEchoes->GetAmplitudeScale();
+        ech_ptr->index = uint32_t( lEcho.mChannelIndex );
+        ech_ptr->distance = float( lEcho.mDistance ) / aResultEchoes->GetDistanceScale();
+        ech_ptr->amplitude = float( lEcho.mAmplitude ) / aResultEchoes->GetAmplitudeScale();
         ech_ptr->timestamp = uint16_t( 0 ); //TODO it should contain offset from main timestamp
-        ech_ptr->flag = uint16_t( lEchoes[i].mFlag );
+        ech_ptr->flag = uint16_t( lEcho.mFlag );
     }
 
     return lEchoesDict;
@@ -1637,3 +1637,57 @@ PyObject *StartStopRecording( sLeddarDevice *self, PyObject *args )
     self->mRecorder->StartRecording( lPath );
     Py_RETURN_TRUE;
 }
+
+#ifdef BUILD_TIMING_STATS
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn PyObject *GetTimingStats( sLeddarDevice *self, PyObject *args )
+///
+/// \brief  Get the timing histograms of each acquisition stage of the sensor
+///
+/// \param [in,out] self    The class instance that this method operates on.
+/// \param [in,out] args    The arguments.
+///                 bool(optional): Reset the histograms after reading them
+///
+/// \return Null if it fails, else a dict with one dict (count, mean, p50, p99, max in nanoseconds) per stage.
+///
+/// \author David Levy
+/// \date   October 2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+PyObject *GetTimingStats( sLeddarDevice *self, PyObject *args )
+{
+    if( !CheckSensor( self ) )
+        return nullptr;
+
+    int lReset = 0;
+
+    if( !PyArg_ParseTuple( args, "|p", &lReset ) )
+        return nullptr;
+
+    LeddarConnection::LdTimingStats *lStats = self->mSensor->GetTimingStats();
+    PyObject *lResult = PyDict_New();
+
+    for( size_t i = 0; i < LeddarConnection::LdTimingStats::TS_COUNT; ++i )
+    {
+        LeddarConnection::LdTimingStats::eStage lStage = static_cast<LeddarConnection::LdTimingStats::eStage>( i );
+        const LeddarConnection::LdTimingHistogram &lHistogram = lStats->GetHistogram( lStage );
+        PyObject *lStageDict = PyDict_New();
+        const char *lKeys[] = { "count", "mean", "p50", "p99", "max" };
+        uint64_t lValues[] = { lHistogram.GetCount(), lHistogram.GetMean(), lHistogram.GetPercentile( 50 ), lHistogram.GetPercentile( 99 ), lHistogram.GetMax() };
+
+        for( size_t j = 0; j < LT_ALEN( lKeys ); ++j )
+        {
+            PyObject *lValue = PyLong_FromUnsignedLongLong( lValues[j] );
+            PyDict_SetItemString( lStageDict, lKeys[j], lValue );
+            Py_DECREF( lValue );
+        }
+
+        PyDict_SetItemString( lResult, LeddarConnection::LdTimingStats::GetStageName( lStage ), lStageDict );
+        Py_DECREF( lStageDict );
+    }
+
+    if( lReset )
+        lStats->Reset();
+
+    return lResult;
+}
+#endif
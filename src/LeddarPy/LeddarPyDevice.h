@@ -17,6 +17,8 @@
 #include <Python.h>
 #include "structmember.h"
 
+#include "LtDefines.h"
+
 #include <stdint.h>
 #include <thread>
 #include <mutex>
@@ -97,6 +99,9 @@ PyObject *SetDataThreadDelay( sLeddarDevice *self, PyObject *args );
 PyObject *PackageEchoes( LeddarConnection::LdResultEchoes *aResultEchoes );
 PyObject *PackageStates( LeddarConnection::LdResultStates *aResultStatess );
 PyObject *StartStopRecording( sLeddarDevice *self, PyObject *args );
+#ifdef BUILD_TIMING_STATS
+PyObject *GetTimingStats( sLeddarDevice *self, PyObject *args );
+#endif
 
 //Python Member function list
 static PyMethodDef Device_methods[] =
@@ -223,6 +228,13 @@ static PyMethodDef Device_methods[] =
         "param1: (string)(optional) Path to the file. If empty, will generate a ltl record with device name and date - time\n"
         "Returns: True"
     },
+#ifdef BUILD_TIMING_STATS
+    {
+        "get_timing_stats", ( PyCFunction )GetTimingStats, METH_VARARGS, "Get the timing of each acquisition stage (transport_read, decode, swap, dispatch).\n"
+        "param1: (bool)(optional) Reset the statistics after reading them\n"
+        "Returns: a dict with, for each stage, a dict with keys 'count', 'mean', 'p50', 'p99' and 'max' (durations in nanoseconds)"
+    },
+#endif
 
     { NULL }  //Sentinel
 };
@@ -51,5 +51,10 @@
 //#define BUILD_SPI_BCM2835       /// SPI using BCM2835 (raspberry pi)
 #define BUILD_CANBUS            /// Generic CANBus (for hardware independent CAN)
 #define BUILD_CANBUS_KOMODO     /// CANBus using Komodo hardware
+#if defined(__linux__)
+#define BUILD_CANBUS_SOCKETCAN  /// CANBus using Linux SocketCAN (can0, vcan0...)
+#endif
 #define BUILD_USB               /// Usb
-#define BUILD_ETHERNET          /// Ethernet
\ No newline at end of file
+#define BUILD_ETHERNET          /// Ethernet
+// Diagnostics
+//#define BUILD_TIMING_STATS      /// Per-stage timing histograms of the acquisition (LdSensor::GetTimingStats)
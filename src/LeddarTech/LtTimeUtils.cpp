@@ -78,3 +78,37 @@ void LeddarUtils::LtTimeUtils::WaitBlockingMicro( uint32_t aMicroseconds )
     nanosleep( &timewait, nullptr );
 #endif
 }
+
+// *****************************************************************************
+// Function: LtTimeUtils::GetMonotonicNanoseconds
+//
+/// \brief   Host monotonic clock (CLOCK_MONOTONIC on Linux, performance
+///          counter on Windows). Only meaningful as a difference between two
+///          values, it is not related to the wall clock.
+///
+/// \return  Time in nanoseconds.
+///
+/// \author  David Levy
+///
+/// \since   October 2026
+// *****************************************************************************
+uint64_t LeddarUtils::LtTimeUtils::GetMonotonicNanoseconds( void )
+{
+#ifdef _WIN32
+    static LARGE_INTEGER sFrequency = { 0 };
+
+    if( sFrequency.QuadPart == 0 )
+    {
+        QueryPerformanceFrequency( &sFrequency );
+    }
+
+    LARGE_INTEGER lCounter;
+    QueryPerformanceCounter( &lCounter );
+    return static_cast<uint64_t>( lCounter.QuadPart / sFrequency.QuadPart ) * 1000000000ULL +
+           static_cast<uint64_t>( lCounter.QuadPart % sFrequency.QuadPart ) * 1000000000ULL / sFrequency.QuadPart;
+#else
+    struct timespec lTime;
+    clock_gettime( CLOCK_MONOTONIC, &lTime );
+    return static_cast<uint64_t>( lTime.tv_sec ) * 1000000000ULL + static_cast<uint64_t>( lTime.tv_nsec );
+#endif
+}
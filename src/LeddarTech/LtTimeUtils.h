@@ -23,5 +23,6 @@ namespace LeddarUtils
     {
         void Wait( uint32_t aMilliseconds );
         void WaitBlockingMicro( uint32_t aMicroseconds );
+        uint64_t GetMonotonicNanoseconds( void );
     }
 }
\ No newline at end of file